@@ -27,6 +27,7 @@
 
 #include "../ForwardDeclarations.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 
@@ -88,7 +89,8 @@ namespace IC
         ///
         const_pointer address(const_reference ref) const noexcept;
 
-        /// Allocates a series of ValueType objects from the wrapped allocator.
+        /// Allocates a series of ValueType objects from the wrapped allocator. The memory
+        /// is aligned to the alignment of ValueType.
         ///
         /// @param count
         ///     The number of objects to allocate.
@@ -99,7 +101,8 @@ namespace IC
 
         /// Deallocates the memory block previously allocated though allocate.
         /// The count must be identical to that provided to allocator otherwise the
-        /// behaviour is undefined.
+        /// behaviour is undefined. The size of the allocation is passed on to the wrapped
+        /// allocator.
         ///
         /// @param pointer
         ///     The memory location to deallocate.
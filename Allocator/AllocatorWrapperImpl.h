@@ -79,13 +79,13 @@ namespace IC
     //------------------------------------------------------------------------------
     template <typename TValueType> typename AllocatorWrapper<TValueType>::pointer AllocatorWrapper<TValueType>::allocate(size_type count, std::allocator<void>::const_pointer hint) noexcept
     {
-        return reinterpret_cast<TValueType*>(m_allocator->Allocate(sizeof(TValueType) * count));
+        return reinterpret_cast<TValueType*>(m_allocator->Allocate(sizeof(TValueType) * count, alignof(TValueType)));
     }
 
     //------------------------------------------------------------------------------
     template <typename TValueType> void AllocatorWrapper<TValueType>::deallocate(pointer pointer, size_type count) noexcept
     {
-        m_allocator->Deallocate(reinterpret_cast<void*>(pointer));
+        m_allocator->Deallocate(reinterpret_cast<void*>(pointer), std::max(sizeof(TValueType) * count, alignof(TValueType)));
     }
 
     //------------------------------------------------------------------------------
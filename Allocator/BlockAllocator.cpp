@@ -25,66 +25,178 @@
 #include "BlockAllocator.h"
 #include "../Utility/MemoryUtils.h"
 
+#include <algorithm>
 #include <vector>
 
 namespace IC
 {
+    namespace
+    {
+        constexpr std::size_t k_maxBufferAlignment = 4096;
+    }
+
     //------------------------------------------------------------------------------
-    BlockAllocator::BlockAllocator(std::size_t blockSize, std::size_t numBlocks) noexcept
+    BlockAllocator::BlockAllocator(std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks) noexcept
         : m_blockSize(blockSize), m_numBlocks(numBlocks), m_bufferSize(m_blockSize * m_numBlocks)
     {
         assert(MemoryUtils::IsAligned(blockSize, sizeof(std::intptr_t)));
         assert(blockSize >= sizeof(FreeBlock));
 
-        m_buffer = new std::uint8_t[m_bufferSize];
+        m_buffer = reinterpret_cast<std::uint8_t*>(MemoryUtils::AllocateAligned(CalcBufferSize(m_blockSize, m_numBlocks, trackAllocatedBlocks), CalcBufferAlignment(m_blockSize)));
 
-        InitFreeBlockList();
+        if (trackAllocatedBlocks)
+        {
+            m_allocatedBlocks = reinterpret_cast<std::uintptr_t*>(m_buffer + m_bufferSize);
+        }
     }
 
     //------------------------------------------------------------------------------
-    BlockAllocator::BlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocks) noexcept        
+    BlockAllocator::BlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks) noexcept        
         : m_blockSize(blockSize), m_numBlocks(numBlocks), m_bufferSize(m_blockSize * m_numBlocks), m_parentAllocator(&parentAllocator)
     {
         assert(MemoryUtils::IsAligned(blockSize, sizeof(std::intptr_t)));
         assert(blockSize >= sizeof(FreeBlock));
 
-        m_buffer = reinterpret_cast<std::uint8_t*>(m_parentAllocator->Allocate(m_bufferSize));
+        m_buffer = reinterpret_cast<std::uint8_t*>(m_parentAllocator->Allocate(CalcBufferSize(m_blockSize, m_numBlocks, trackAllocatedBlocks), CalcBufferAlignment(m_blockSize)));
 
-        InitFreeBlockList();
+        if (trackAllocatedBlocks)
+        {
+            m_allocatedBlocks = reinterpret_cast<std::uintptr_t*>(m_buffer + m_bufferSize);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    BlockAllocator::BlockAllocator(void* buffer, std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks) noexcept        
+        : m_blockSize(blockSize), m_numBlocks(numBlocks), m_bufferSize(m_blockSize * m_numBlocks), m_isBufferOwned(false), m_buffer(reinterpret_cast<std::uint8_t*>(buffer))
+    {
+        assert(MemoryUtils::IsAligned(blockSize, sizeof(std::intptr_t)));
+        assert(blockSize >= sizeof(FreeBlock));
+        assert(m_buffer);
+        assert(MemoryUtils::IsAligned(reinterpret_cast<std::uintptr_t>(m_buffer), CalcBufferAlignment(m_blockSize)));
+
+        if (trackAllocatedBlocks)
+        {
+            m_allocatedBlocks = reinterpret_cast<std::uintptr_t*>(m_buffer + m_bufferSize);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t BlockAllocator::CalcBufferAlignment(std::size_t blockSize) noexcept
+    {
+        return std::min(MemoryUtils::CalcNaturalAlignment(blockSize), k_maxBufferAlignment);
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t BlockAllocator::CalcBufferSize(std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks) noexcept
+    {
+        if (!trackAllocatedBlocks)
+        {
+            return blockSize * numBlocks;
+        }
+
+        return blockSize * numBlocks + ((numBlocks + k_bitsPerWord - 1) / k_bitsPerWord) * sizeof(std::uintptr_t);
     }
 
     //------------------------------------------------------------------------------
     void* BlockAllocator::Allocate(std::size_t allocationSize) noexcept
     {
         assert(allocationSize <= m_blockSize);
-        assert(m_freeBlockList);
+        assert(m_freeBlockList || m_numInitialisedBlocks < m_numBlocks);
 
-        auto block = m_freeBlockList;
-        m_freeBlockList = block->m_next;
+        ++m_numAllocatedBlocks;
 
+        void* block;
         if (m_freeBlockList)
         {
-            m_freeBlockList->m_previous = nullptr;
+            block = m_freeBlockList;
+            m_freeBlockList = m_freeBlockList->m_next;
+        }
+        else
+        {
+            block = TakeUninitialisedBlock();
         }
 
-        ++m_numAllocatedBlocks;
+        SetAllocated(block, true);
 
         return block;
     }
 
+    //------------------------------------------------------------------------------
+    void* BlockAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+        assert(MemoryUtils::IsAligned(m_blockSize, alignment));
+        assert(MemoryUtils::IsAligned(reinterpret_cast<std::uintptr_t>(m_buffer), alignment));
+
+        return Allocate(allocationSize);
+    }
+
     //------------------------------------------------------------------------------
     void BlockAllocator::Deallocate(void* pointer) noexcept
     {
         assert(ContainsBlock(pointer));
 
+        SetAllocated(pointer, false);
+
         auto next = m_freeBlockList;
         m_freeBlockList = reinterpret_cast<FreeBlock*>(pointer);
         m_freeBlockList->m_next = next;
-        m_freeBlockList->m_previous = nullptr;
 
         --m_numAllocatedBlocks;
     }
 
+    //------------------------------------------------------------------------------
+    void BlockAllocator::AllocateBatch(std::size_t allocationSize, std::size_t numBlocks, void** out_blocks) noexcept
+    {
+        assert(allocationSize <= m_blockSize);
+        assert(out_blocks || numBlocks == 0);
+        assert(numBlocks <= GetNumFreeBlocks());
+
+        std::size_t numAllocated = 0;
+        while (numAllocated < numBlocks && m_freeBlockList)
+        {
+            SetAllocated(m_freeBlockList, true);
+            out_blocks[numAllocated++] = m_freeBlockList;
+            m_freeBlockList = m_freeBlockList->m_next;
+        }
+
+        while (numAllocated < numBlocks)
+        {
+            auto block = TakeUninitialisedBlock();
+            SetAllocated(block, true);
+            out_blocks[numAllocated++] = block;
+        }
+
+        m_numAllocatedBlocks += numBlocks;
+    }
+
+    //------------------------------------------------------------------------------
+    void BlockAllocator::DeallocateBatch(void* const* pointers, std::size_t numPointers) noexcept
+    {
+        assert(pointers || numPointers == 0);
+
+        for (std::size_t i = 0; i < numPointers; ++i)
+        {
+            assert(ContainsBlock(pointers[i]));
+
+            SetAllocated(pointers[i], false);
+
+            auto block = reinterpret_cast<FreeBlock*>(pointers[i]);
+            block->m_next = m_freeBlockList;
+            m_freeBlockList = block;
+        }
+
+        m_numAllocatedBlocks -= numPointers;
+    }
+
+    //------------------------------------------------------------------------------
+    bool BlockAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        assert(ContainsBlock(pointer));
+
+        return newSize <= m_blockSize;
+    }
+
     //------------------------------------------------------------------------------
     bool BlockAllocator::ContainsBlock(void* block) noexcept
     {
@@ -92,38 +204,57 @@ namespace IC
     }
 
     //------------------------------------------------------------------------------
-    void BlockAllocator::InitFreeBlockList() noexcept
+    void* BlockAllocator::TakeUninitialisedBlock() noexcept
     {
-        FreeBlock* previous = nullptr;
-        for (std::size_t i = 0; i < m_numBlocks; ++i)
+        assert(m_numInitialisedBlocks < m_numBlocks);
+
+        auto index = m_numInitialisedBlocks++;
+        if (m_allocatedBlocks && index % k_bitsPerWord == 0)
         {
-            auto current = reinterpret_cast<FreeBlock*>(m_buffer + m_blockSize * i);
-            current->m_next = nullptr;
-            current->m_previous = previous;
+            m_allocatedBlocks[index / k_bitsPerWord] = 0;
+        }
 
-            if (previous)
-            {
-                previous->m_next = current;
-            }
+        return m_buffer + m_blockSize * index;
+    }
 
-            previous = current;
+    //------------------------------------------------------------------------------
+    void BlockAllocator::SetAllocated(void* block, bool isAllocated) noexcept
+    {
+        if (!m_allocatedBlocks)
+        {
+            return;
         }
 
-        m_freeBlockList = reinterpret_cast<FreeBlock*>(m_buffer);
+        auto index = MemoryUtils::GetPointerOffset(block, m_buffer) / m_blockSize;
+        auto bit = std::uintptr_t(1) << (index % k_bitsPerWord);
+
+        if (isAllocated)
+        {
+            m_allocatedBlocks[index / k_bitsPerWord] |= bit;
+        }
+        else
+        {
+            m_allocatedBlocks[index / k_bitsPerWord] &= ~bit;
+        }
     }
-    
+
     //------------------------------------------------------------------------------
     BlockAllocator::~BlockAllocator() noexcept
     {
         assert(m_numAllocatedBlocks == 0);
 
+        if (!m_isBufferOwned)
+        {
+            return;
+        }
+
         if (m_parentAllocator)
         {
             m_parentAllocator->Deallocate(m_buffer);
         }
         else
         {
-            delete[] m_buffer;
+            MemoryUtils::DeallocateAligned(m_buffer);
         }
     }
 }
\ No newline at end of file
@@ -35,7 +35,21 @@ namespace IC
     /// Allocations of a bigger size than that of a single block are not possible.
     ///
     /// A BlockAllocator can be backed by other allocator types, from which the block
-    /// buffer will be allocated, otherwise it is allocated from the free store.
+    /// buffer will be allocated, otherwise it is allocated from the free store. 
+    /// Alternatively, an existing buffer can be provided which the allocator will not
+    /// take ownership of.
+    ///
+    /// The buffer is aligned to the largest power of two which the block size is a
+    /// multiple of, up to 4096 bytes, so every block shares the same alignment.
+    ///
+    /// Blocks which have never been allocated are not touched on construction. Instead
+    /// they are handed out in order from a high-water mark once the free block list is
+    /// empty, so construction is O(1) and buffer memory is only touched on first use.
+    ///
+    /// Optionally, a bitmap of allocated blocks can be stored after the blocks in the
+    /// buffer, which allows the allocated blocks to be iterated over in address order.
+    /// This is off by default, as it costs a bitmap update on every allocation and
+    /// deallocation, so should only be enabled where ForEachAllocatedBlock() is needed.
     ///
     /// Note that this is not thread-safe and should not be accessed from multiple
     /// threads at the same time.
@@ -47,11 +61,14 @@ namespace IC
         ///
         /// @param blockSize
         ///        The size of each block in the allocator. The block size must be multiple
-        ///        of the size of a pointer, at at least twice the size of a pointer.
+        ///        of the size of a pointer, and at least the size of a pointer.
         /// @param numBlocks
         ///        The number of blocks available to the block allocator.
+        /// @param trackAllocatedBlocks
+        ///        Optional. Whether or not to keep a bitmap of allocated blocks, which is
+        ///        required by ForEachAllocatedBlock(). Defaults to false.
         /// 
-        BlockAllocator(std::size_t blockSize, std::size_t numBlocks) noexcept;
+        BlockAllocator(std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks = false) noexcept;
 
         /// Creates a new BlockAllocator with a buffer allocated from the given allocator.
         ///
@@ -59,11 +76,58 @@ namespace IC
         ///        The allocator from which to allocate the block buffer.
         /// @param blockSize
         ///        The size of each block in the allocator. The block size must be multiple
-        ///        of the size of a pointer, at at least twice the size of a pointer.
+        ///        of the size of a pointer, and at least the size of a pointer.
         /// @param numBlocks
         ///        The number of blocks available to the block allocator.
+        /// @param trackAllocatedBlocks
+        ///        Optional. Whether or not to keep a bitmap of allocated blocks, which is
+        ///        required by ForEachAllocatedBlock(). Defaults to false.
         /// 
-        BlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocks) noexcept;
+        BlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks = false) noexcept;
+
+        /// Creates a new BlockAllocator using the given buffer. The buffer must be at least
+        /// the buffer size for the block size, number of blocks and tracking option, and must
+        /// be aligned to the buffer alignment for the block size. The buffer must outlive the
+        /// allocator.
+        ///
+        /// @param buffer
+        ///        The buffer from which blocks will be allocated.
+        /// @param blockSize
+        ///        The size of each block in the allocator. The block size must be multiple
+        ///        of the size of a pointer, and at least the size of a pointer.
+        /// @param numBlocks
+        ///        The number of blocks available to the block allocator.
+        /// @param trackAllocatedBlocks
+        ///        Optional. Whether or not to keep a bitmap of allocated blocks, which is
+        ///        required by ForEachAllocatedBlock(). Defaults to false.
+        /// 
+        BlockAllocator(void* buffer, std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks = false) noexcept;
+
+        /// This is thread-safe.
+        ///
+        /// @param blockSize
+        ///        The size of each block.
+        ///
+        /// @return The alignment of the buffer for the given block size. This is the largest
+        /// power of two which the block size is a multiple of, up to 4096 bytes.
+        ///
+        static std::size_t CalcBufferAlignment(std::size_t blockSize) noexcept;
+
+        /// This is thread-safe.
+        ///
+        /// @param blockSize
+        ///        The size of each block.
+        /// @param numBlocks
+        ///        The number of blocks.
+        /// @param trackAllocatedBlocks
+        ///        Optional. Whether or not the allocated blocks are tracked. Defaults to
+        ///        false.
+        ///
+        /// @return The size of the buffer required for the given number of blocks. This 
+        /// is the size of the blocks, plus the size of the allocated block bitmap if the
+        /// allocated blocks are tracked.
+        ///
+        static std::size_t CalcBufferSize(std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks = false) noexcept;
 
         /// This is thread safe.
         ///
@@ -84,6 +148,13 @@ namespace IC
         ///
         std::size_t GetNumBlocks() const noexcept { return m_numBlocks; }
 
+        /// This is thread-safe.
+        ///
+        /// @return Whether or not a bitmap of allocated blocks is kept, allowing
+        /// ForEachAllocatedBlock() to be used.
+        ///
+        bool IsTrackingAllocatedBlocks() const noexcept { return m_allocatedBlocks != nullptr; }
+
         /// @return The current number of allocated blocks in the allocator.
         ///
         std::size_t GetNumAllocatedBlocks() const noexcept { return m_numAllocatedBlocks; }
@@ -103,6 +174,20 @@ namespace IC
         ///
         void* Allocate(std::size_t allocationSize) noexcept override;
 
+        /// Allocates a block from the allocator. The allocation size must be smaller than 
+        /// that of a block and every block must meet the requested alignment, otherwise 
+        /// this will assert. If there are no free blocks in the buffer then this will
+        /// assert.
+        ///
+        /// @param allocationSize
+        ///        The size of allocation required.
+        /// @param alignment
+        ///        The alignment required. Must be a power of two.
+        ///
+        /// @return The block of memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
         /// Deallocates the given block, freeing it for reuse.
         ///
         /// @param pointer
@@ -110,6 +195,44 @@ namespace IC
         ///
         void Deallocate(void* pointer) noexcept override;
 
+        /// Allocates the given number of blocks from the allocator, as if Allocate() had
+        /// been called for each. Blocks are first taken from the free block list, then
+        /// from the blocks which have never been allocated, which are contiguous and in
+        /// address order. If there are not enough free blocks in the buffer then
+        /// this will assert.
+        ///
+        /// @param allocationSize
+        ///        The size of allocation required for each block.
+        /// @param numBlocks
+        ///        The number of blocks to allocate.
+        /// @param out_blocks
+        ///        (Out) The array the allocated blocks are written to. This must have space
+        ///        for at least numBlocks pointers.
+        ///
+        void AllocateBatch(std::size_t allocationSize, std::size_t numBlocks, void** out_blocks) noexcept;
+
+        /// Deallocates each of the given blocks, as if Deallocate() had been called for
+        /// each. The blocks are linked together and added to the
+        /// free block list in one go.
+        ///
+        /// @param pointers
+        ///     The array of pointers to the blocks which are to be freed.
+        /// @param numPointers
+        ///     The number of pointers in the array.
+        ///
+        void DeallocateBatch(void* const* pointers, std::size_t numPointers) noexcept;
+
+        /// Resizing a block in place succeeds if the new size still fits in a single block.
+        ///
+        /// @param pointer
+        ///        The block which should be resized.
+        /// @param newSize
+        ///        The requested size of the allocation.
+        ///
+        /// @return Whether or not the new size fits in the block.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
         /// Evaluates whether or not the given block pointer was allocated from this block
         /// allocator.
         ///
@@ -120,37 +243,68 @@ namespace IC
         ///
         bool ContainsBlock(void* block) noexcept;
 
+        /// Calls the given function for each allocated block, in address order. This scans
+        /// the allocated block bitmap a word at a time, skipping words with no allocated
+        /// blocks, so the allocator must have been created with block tracking enabled.
+        /// Blocks must not be allocated or deallocated while iterating.
+        ///
+        /// @param function
+        ///        The function to call, which takes a pointer to the block.
+        ///
+        template <typename TFunction> void ForEachAllocatedBlock(TFunction&& function) const noexcept;
+
         ~BlockAllocator() noexcept;
 
     private:
-        /// A container for information on free blocks within the pool.
+        /// A container for information on free blocks within the pool. Blocks are only
+        /// ever pushed to and popped from the front of the free block list, so it is
+        /// singly linked, allowing blocks as small as a single pointer.
         ///
         struct FreeBlock final
         {
             FreeBlock* m_next = nullptr;
-            FreeBlock* m_previous = nullptr;
         };
 
+        static constexpr std::size_t k_bitsPerWord = sizeof(std::uintptr_t) * 8;
+
         BlockAllocator(BlockAllocator&) = delete;
         BlockAllocator& operator=(BlockAllocator&) = delete;
         BlockAllocator(BlockAllocator&&) = delete;
         BlockAllocator& operator=(BlockAllocator&&) = delete;
 
-        /// Iterates over the memory buffer setting all blocks to "free", and
-        /// storing the free block list as an in-place doubly linked list.
+        /// Takes the next block from the blocks which have never been allocated, clearing
+        /// its word in the allocated block bitmap if blocks are tracked and it is the first
+        /// block in the word.
+        ///
+        /// @return The block.
         ///
-        void InitFreeBlockList() noexcept;
+        void* TakeUninitialisedBlock() noexcept;
+
+        /// Sets or clears the bit for the given block in the allocated block bitmap. This
+        /// does nothing if blocks are not tracked.
+        ///
+        /// @param block
+        ///        The block.
+        /// @param isAllocated
+        ///        Whether or not the block is allocated.
+        ///
+        void SetAllocated(void* block, bool isAllocated) noexcept;
 
         const std::size_t m_blockSize;
         const std::size_t m_numBlocks;
         const std::size_t m_bufferSize;
 
         IAllocator* m_parentAllocator = nullptr;
+        bool m_isBufferOwned = true;
 
         std::uint8_t* m_buffer = nullptr;
+        std::uintptr_t* m_allocatedBlocks = nullptr;
         FreeBlock* m_freeBlockList = nullptr;
+        std::size_t m_numInitialisedBlocks = 0;
         std::size_t m_numAllocatedBlocks = 0;
     };
 }
 
+#include "BlockAllocatorImpl.h"
+
 #endif
\ No newline at end of file
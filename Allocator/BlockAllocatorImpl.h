@@ -0,0 +1,50 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORY_ALLOCATOR_BLOCKALLOCATORIMPL_H_
+#define _ICMEMORY_ALLOCATOR_BLOCKALLOCATORIMPL_H_
+
+#include "../Utility/MemoryUtils.h"
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    template <typename TFunction> void BlockAllocator::ForEachAllocatedBlock(TFunction&& function) const noexcept
+    {
+        assert(IsTrackingAllocatedBlocks());
+
+        auto numWords = (m_numInitialisedBlocks + k_bitsPerWord - 1) / k_bitsPerWord;
+        for (std::size_t wordIndex = 0; wordIndex < numWords; ++wordIndex)
+        {
+            auto word = m_allocatedBlocks[wordIndex];
+            while (word != 0)
+            {
+                auto index = wordIndex * k_bitsPerWord + MemoryUtils::CalcTrailingZeros(word);
+                function(reinterpret_cast<void*>(m_buffer + m_blockSize * index));
+
+                word &= word - 1;
+            }
+        }
+    }
+}
+
+#endif
@@ -26,12 +26,17 @@
 
 #include "../Utility/MemoryUtils.h"
 
+#include <algorithm>
 #include <cassert>
+#include <climits>
+#include <cstring>
 
 namespace IC
 {
     namespace
     {
+        constexpr std::size_t k_maxBufferAlignment = 64 * 1024;
+
         /// Calculates the number of levels required for the given buffer size and
         /// min block size.
         ///
@@ -59,17 +64,20 @@ namespace IC
             return numBlockLevels * sizeof(std::uintptr_t);
         }
 
-        /// Calculates the size of the split or allocated tables in bits based on the number
-        /// of levels.
+        /// Calculates the offset in bytes of the given level in the split or allocated
+        /// tables. Each level starts on a new byte so that no two levels share a byte,
+        /// allowing different levels to be modified concurrently when per-level locking
+        /// is in use. The first three levels contain fewer than a byte of flags, so use
+        /// a byte each; every subsequent level uses exactly 2^(level - 3) bytes.
         ///
-        /// @param numBlockLevels
-        ///     The number of levels.
+        /// @param tableLevel
+        ///     The level in the table.
         ///
-        /// @return The split or allocated table size in bits.
+        /// @return The offset of the level in bytes.
         ///
-        constexpr std::size_t CalcBlockDataTableSizeBits(std::size_t numBlockLevels) noexcept
+        constexpr std::size_t CalcBlockDataTableLevelOffset(std::size_t tableLevel) noexcept
         {
-            return (1 << (numBlockLevels - 1)) - 1;
+            return (tableLevel <= 3) ? tableLevel : (std::size_t(1) << (tableLevel - 3)) + 2;
         }
 
         /// Calculates the size of the split or allocated tables in bytes based on the number
@@ -82,7 +90,7 @@ namespace IC
         ///
         constexpr std::size_t CalcBlockDataTableSize(std::size_t numBlockLevels) noexcept
         {
-            return (CalcBlockDataTableSizeBits(numBlockLevels) + CHAR_BIT - 1) / CHAR_BIT;
+            return CalcBlockDataTableLevelOffset(numBlockLevels - 1);
         }
 
         /// Calculates the size of the split or allocated tables in bytes, aligned to the size
@@ -98,16 +106,38 @@ namespace IC
             return MemoryUtils::Align(CalcBlockDataTableSize(numBlockLevels), sizeof(std::uintptr_t));
         }
 
+        /// Calculates the size of the level table in bytes, aligned to the size of a
+        /// pointer. If the level table isn't in use this will be zero.
+        ///
+        /// @param numBlockLevels
+        ///     The number of levels.
+        /// @param blockLevelLookup
+        ///     The block level lookup method in use.
+        ///
+        /// @return The aligned level table size in bytes.
+        ///
+        inline std::size_t CalcLevelTableSizeAligned(std::size_t numBlockLevels, BuddyAllocator::BlockLevelLookup blockLevelLookup) noexcept
+        {
+            if (blockLevelLookup != BuddyAllocator::BlockLevelLookup::k_table)
+            {
+                return 0;
+            }
+
+            return MemoryUtils::Align(std::size_t(1) << (numBlockLevels - 1), sizeof(std::uintptr_t));
+        }
+
         /// Calculates the total size of the header, based on the number of levels.
         ///
         /// @param numBlockLevels
         ///     The number of levels.
+        /// @param blockLevelLookup
+        ///     The block level lookup method in use.
         ///
         /// @return The total header size.
         ///
-        inline std::size_t CalcHeaderSize(std::size_t numBlockLevels) noexcept
+        inline std::size_t CalcHeaderSize(std::size_t numBlockLevels, BuddyAllocator::BlockLevelLookup blockLevelLookup) noexcept
         {
-            return CalcFreeListTableSize(numBlockLevels) + 2 * CalcBlockDataTableSizeAligned(numBlockLevels);
+            return CalcFreeListTableSize(numBlockLevels) + 2 * CalcBlockDataTableSizeAligned(numBlockLevels) + CalcLevelTableSizeAligned(numBlockLevels, blockLevelLookup);
         }
 
         /// @param blockLevel
@@ -122,23 +152,81 @@ namespace IC
     }
 
     //------------------------------------------------------------------------------
-    BuddyAllocator::BuddyAllocator(std::size_t bufferSize, std::size_t minBlockSize) noexcept
+    BuddyAllocator::BuddyAllocator(std::size_t bufferSize, std::size_t minBlockSize, BlockLevelLookup blockLevelLookup, LockingMode lockingMode) noexcept
+        : m_bufferSize(bufferSize),
+        m_minBlockSize(minBlockSize),
+        m_numBlockLevels(CalcNumLevels(m_bufferSize, m_minBlockSize)),
+        m_blockLevelLookup(blockLevelLookup),
+        m_lockingMode(lockingMode),
+        m_headerSize(CalcHeaderSize(m_numBlockLevels, m_blockLevelLookup)),
+        m_allocationCount(0)
+    {
+        assert(MemoryUtils::IsPowerOfTwo(m_bufferSize));
+        assert(MemoryUtils::IsPowerOfTwo(m_minBlockSize));
+        assert(m_minBlockSize >= sizeof(std::uintptr_t) * 2);
+        assert(m_numBlockLevels > 1);
+        assert(m_numBlockLevels <= UINT8_MAX);
+        assert(m_headerSize < m_bufferSize);
+        assert(m_lockingMode != LockingMode::k_perLevel || m_blockLevelLookup == BlockLevelLookup::k_table);
+
+        m_buffer = reinterpret_cast<std::uint8_t*>(MemoryUtils::AllocateAligned(m_bufferSize, GetMaxAlignment()));
+
+        if (m_lockingMode == LockingMode::k_perLevel)
+        {
+            m_levelMutexes = std::unique_ptr<std::mutex[]>(new std::mutex[m_numBlockLevels]);
+        }
+
+        InitFreeListTable();
+        InitAllocatedTable();
+        InitSplitTable();
+        InitLevelTable();
+    }
+
+    //------------------------------------------------------------------------------
+    BuddyAllocator::BuddyAllocator(IAllocator& parentAllocator, std::size_t bufferSize, std::size_t minBlockSize, BlockLevelLookup blockLevelLookup, LockingMode lockingMode) noexcept
         : m_bufferSize(bufferSize),
         m_minBlockSize(minBlockSize),
         m_numBlockLevels(CalcNumLevels(m_bufferSize, m_minBlockSize)),
-        m_headerSize(CalcHeaderSize(m_numBlockLevels))
+        m_blockLevelLookup(blockLevelLookup),
+        m_lockingMode(lockingMode),
+        m_headerSize(CalcHeaderSize(m_numBlockLevels, m_blockLevelLookup)),
+        m_parentAllocator(&parentAllocator),
+        m_allocationCount(0)
     {
         assert(MemoryUtils::IsPowerOfTwo(m_bufferSize));
         assert(MemoryUtils::IsPowerOfTwo(m_minBlockSize));
         assert(m_minBlockSize >= sizeof(std::uintptr_t) * 2);
         assert(m_numBlockLevels > 1);
+        assert(m_numBlockLevels <= UINT8_MAX);
         assert(m_headerSize < m_bufferSize);
+        assert(m_lockingMode != LockingMode::k_perLevel || m_blockLevelLookup == BlockLevelLookup::k_table);
+
+        m_buffer = reinterpret_cast<std::uint8_t*>(m_parentAllocator->Allocate(m_bufferSize, GetMaxAlignment()));
 
-        m_buffer = std::unique_ptr<std::uint8_t[]>(new std::uint8_t[m_bufferSize]);
+        if (m_lockingMode == LockingMode::k_perLevel)
+        {
+            m_levelMutexes = std::unique_ptr<std::mutex[]>(new std::mutex[m_numBlockLevels]);
+        }
 
         InitFreeListTable();
         InitAllocatedTable();
         InitSplitTable();
+        InitLevelTable();
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t BuddyAllocator::GetMaxAlignment() const noexcept
+    {
+        return std::min(m_bufferSize, k_maxBufferAlignment);
+    }
+
+    //------------------------------------------------------------------------------
+    void* BuddyAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+        assert(alignment <= GetMaxAlignment());
+
+        return Allocate(std::max(allocationSize, alignment));
     }
 
     //------------------------------------------------------------------------------
@@ -148,7 +236,7 @@ namespace IC
         auto level = GetLevel(blockSize);
         assert(level != 0);
 
-        std::unique_lock<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_lockingMode == LockingMode::k_global ? m_mutex : m_levelMutexes[level]);
 
         auto block = m_freeListTable.GetStart(level);
         if (!block)
@@ -164,6 +252,11 @@ namespace IC
         auto blockIndex = GetBlockIndex(level, block);
         m_allocatedTable.ToggleAllocatedFlag(level, blockIndex);
 
+        if (m_blockLevelLookup == BlockLevelLookup::k_table)
+        {
+            m_levelTable.SetLevel(GetBlockIndex(m_numBlockLevels - 1, block), level);
+        }
+
         ++m_allocationCount;
 
         return block;
@@ -172,21 +265,190 @@ namespace IC
     //------------------------------------------------------------------------------
     void BuddyAllocator::Deallocate(void* blockPointer) noexcept
     {
-        assert(blockPointer >= m_buffer.get());
-        assert(MemoryUtils::GetPointerOffset(blockPointer, m_buffer.get()) < m_bufferSize);
+        std::unique_lock<std::mutex> globalLock;
+        if (m_lockingMode == LockingMode::k_global)
+        {
+            globalLock = std::unique_lock<std::mutex>(m_mutex);
+        }
+
+        DeallocateBlock(blockPointer);
+    }
+
+    //------------------------------------------------------------------------------
+    void BuddyAllocator::Deallocate(void* blockPointer, std::size_t allocationSize) noexcept
+    {
+        auto blockSize = MemoryUtils::Align(MemoryUtils::NextPowerofTwo(allocationSize), m_minBlockSize);
+        auto level = GetLevel(blockSize);
+
+        std::unique_lock<std::mutex> globalLock;
+        if (m_lockingMode == LockingMode::k_global)
+        {
+            globalLock = std::unique_lock<std::mutex>(m_mutex);
+        }
+
+        DeallocateBlock(blockPointer, level);
+    }
+
+    //------------------------------------------------------------------------------
+    bool BuddyAllocator::TryResizeInPlace(void* blockPointer, std::size_t newSize) noexcept
+    {
+        auto newBlockSize = MemoryUtils::Align(MemoryUtils::NextPowerofTwo(newSize), m_minBlockSize);
+        if (newBlockSize > GetMaxAllocationSize())
+        {
+            return false;
+        }
 
-        std::unique_lock<std::mutex> lock(m_mutex);
+        auto newLevel = GetLevel(newBlockSize);
+
+        std::unique_lock<std::mutex> globalLock;
+        if (m_lockingMode == LockingMode::k_global)
+        {
+            globalLock = std::unique_lock<std::mutex>(m_mutex);
+        }
 
         std::size_t level, index;
         GetAllocatedBlockInfo(blockPointer, level, index);
-        assert(level > 0 && level < m_numBlockLevels);
 
-        m_allocatedTable.ToggleAllocatedFlag(level, index);
-        m_freeListTable.Add(level, blockPointer);
+        if (newLevel == level)
+        {
+            return true;
+        }
+
+        // Every level between the two must be held, locking from the smallest blocks towards the root.
+        auto minLevel = std::min(level, newLevel);
+        auto maxLevel = std::max(level, newLevel);
+        if (m_lockingMode == LockingMode::k_perLevel)
+        {
+            for (auto lockLevel = maxLevel; lockLevel >= minLevel; --lockLevel)
+            {
+                m_levelMutexes[lockLevel].lock();
+            }
+        }
+
+        bool resized = true;
+        if (newLevel > level)
+        {
+            // Repeatedly split the block, keeping the first child and freeing the second. The block
+            // remains allocated, so its own allocated flag is unchanged.
+            for (; level < newLevel; ++level)
+            {
+                m_splitTable.SetSplit(level, index, true);
+
+                std::size_t childBlockIndexA, childBlockIndexB;
+                GetChildBlockIndices(level, index, childBlockIndexA, childBlockIndexB);
 
-        std::size_t parentLevel = level - 1;
-        std::size_t parentIndex = GetParentBlockIndex(level, index);
-        TryMergeBlock(parentLevel, parentIndex);
+                m_allocatedTable.ToggleAllocatedFlag(level + 1, childBlockIndexA);
+                m_freeListTable.Add(level + 1, GetBlockPointer(level + 1, childBlockIndexB));
+
+                index = childBlockIndexA;
+            }
+        }
+        else
+        {
+            // The block can only grow if it is the first of each buddy pair, and the buddy is free.
+            // As the block is allocated, a set allocated flag indicates that the buddy is free.
+            auto checkIndex = index;
+            for (auto checkLevel = level; checkLevel > newLevel; --checkLevel)
+            {
+                if (checkIndex % 2 != 0 || !m_allocatedTable.GetAllocatedFlag(checkLevel, checkIndex))
+                {
+                    resized = false;
+                    break;
+                }
+
+                checkIndex = GetParentBlockIndex(checkLevel, checkIndex);
+            }
+
+            if (resized)
+            {
+                for (; level > newLevel; --level)
+                {
+                    m_freeListTable.Remove(level, GetBlockPointer(level, index + 1));
+                    m_allocatedTable.ToggleAllocatedFlag(level, index);
+
+                    index = GetParentBlockIndex(level, index);
+                    m_splitTable.SetSplit(level - 1, index, false);
+                }
+            }
+        }
+
+        if (resized && m_blockLevelLookup == BlockLevelLookup::k_table)
+        {
+            m_levelTable.SetLevel(GetBlockIndex(m_numBlockLevels - 1, blockPointer), newLevel);
+        }
+
+        if (m_lockingMode == LockingMode::k_perLevel)
+        {
+            for (auto lockLevel = minLevel; lockLevel <= maxLevel; ++lockLevel)
+            {
+                m_levelMutexes[lockLevel].unlock();
+            }
+        }
+
+        return resized;
+    }
+
+    //------------------------------------------------------------------------------
+    void BuddyAllocator::DeallocateBatch(void* const* pointers, std::size_t numPointers) noexcept
+    {
+        assert(pointers || numPointers == 0);
+
+        std::unique_lock<std::mutex> globalLock;
+        if (m_lockingMode == LockingMode::k_global)
+        {
+            globalLock = std::unique_lock<std::mutex>(m_mutex);
+        }
+
+        for (std::size_t i = 0; i < numPointers; ++i)
+        {
+            DeallocateBlock(pointers[i]);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t BuddyAllocator::GetAllocatedBlockSize(void* pointer) noexcept
+    {
+        std::unique_lock<std::mutex> globalLock;
+        if (m_blockLevelLookup == BlockLevelLookup::k_search)
+        {
+            globalLock = std::unique_lock<std::mutex>(m_mutex);
+        }
+
+        std::size_t level, index;
+        GetAllocatedBlockInfo(pointer, level, index);
+
+        return GetBlockSize(level);
+    }
+
+    //------------------------------------------------------------------------------
+    void BuddyAllocator::DeallocateBlock(void* blockPointer) noexcept
+    {
+        assert(blockPointer >= m_buffer);
+        assert(MemoryUtils::GetPointerOffset(blockPointer, m_buffer) < m_bufferSize);
+
+        std::size_t level, index;
+        GetAllocatedBlockInfo(blockPointer, level, index);
+
+        DeallocateBlock(blockPointer, level);
+    }
+
+    //------------------------------------------------------------------------------
+    void BuddyAllocator::DeallocateBlock(void* blockPointer, std::size_t blockLevel) noexcept
+    {
+        assert(blockPointer >= m_buffer);
+        assert(MemoryUtils::GetPointerOffset(blockPointer, m_buffer) < m_bufferSize);
+        assert(blockLevel > 0 && blockLevel < m_numBlockLevels);
+        assert(m_blockLevelLookup == BlockLevelLookup::k_search || m_levelTable.GetLevel(GetBlockIndex(m_numBlockLevels - 1, blockPointer)) == blockLevel);
+
+        auto index = GetBlockIndex(blockLevel, blockPointer);
+        auto levelLock = LockLevel(blockLevel);
+
+        m_allocatedTable.ToggleAllocatedFlag(blockLevel, index);
+        m_freeListTable.Add(blockLevel, blockPointer);
+
+        std::size_t parentLevel = blockLevel - 1;
+        std::size_t parentIndex = GetParentBlockIndex(blockLevel, index);
+        TryMergeBlock(parentLevel, parentIndex, levelLock);
 
         --m_allocationCount;
     }
@@ -194,7 +456,7 @@ namespace IC
     //------------------------------------------------------------------------------
     void BuddyAllocator::InitFreeListTable() noexcept
     {
-        m_freeListTable = FreeListTable(m_numBlockLevels, m_buffer.get());
+        m_freeListTable = FreeListTable(m_numBlockLevels, m_buffer);
 
         auto relativeBufferBodyStart = static_cast<std::uintptr_t>(MemoryUtils::Align(m_headerSize, m_minBlockSize));
         for (std::size_t level = 0; level < m_numBlockLevels; ++level)
@@ -202,7 +464,7 @@ namespace IC
             auto relativeFirstFreeBlock = MemoryUtils::Align(relativeBufferBodyStart, GetBlockSize(level));
             if (relativeFirstFreeBlock < m_bufferSize)
             {
-                void* firstFreeBlock = m_buffer.get() + relativeFirstFreeBlock;
+                void* firstFreeBlock = m_buffer + relativeFirstFreeBlock;
 
                 if (GetBlockIndex(level, firstFreeBlock) % 2 == 1)
                 {
@@ -215,7 +477,7 @@ namespace IC
     //------------------------------------------------------------------------------
     void BuddyAllocator::InitAllocatedTable() noexcept
     {
-        m_allocatedTable = AllocatedTable(m_numBlockLevels, m_buffer.get() + CalcFreeListTableSize(m_numBlockLevels));
+        m_allocatedTable = AllocatedTable(m_numBlockLevels, m_buffer + CalcFreeListTableSize(m_numBlockLevels));
 
         for (std::size_t level = 1; level < m_numBlockLevels; ++level)
         {
@@ -224,7 +486,7 @@ namespace IC
             auto firstFreeIndex = GetNumIndicesForLevel(level);
             if (relativeEndOfAllocated < m_bufferSize)
             {
-                auto endOfAllocated = m_buffer.get() + relativeEndOfAllocated;
+                auto endOfAllocated = m_buffer + relativeEndOfAllocated;
                 firstFreeIndex = GetBlockIndex(level, endOfAllocated);
             }
 
@@ -240,14 +502,14 @@ namespace IC
     {
         const auto numParentLevels = m_numBlockLevels - 1;
 
-        m_splitTable = SplitTable(numParentLevels, m_buffer.get() + CalcFreeListTableSize(m_numBlockLevels) + CalcBlockDataTableSizeAligned(m_numBlockLevels));
+        m_splitTable = SplitTable(numParentLevels, m_buffer + CalcFreeListTableSize(m_numBlockLevels) + CalcBlockDataTableSizeAligned(m_numBlockLevels));
 
         auto relativeBufferBodyStart = static_cast<std::uintptr_t>(MemoryUtils::Align(m_headerSize, m_minBlockSize));
 
         for (std::size_t level = 0; level < numParentLevels; ++level)
         {
             auto relativeLastSplitBlock = MemoryUtils::Align(relativeBufferBodyStart, GetBlockSize(level)) - GetBlockSize(level);
-            auto lastSplitBlock = m_buffer.get() + relativeLastSplitBlock;
+            auto lastSplitBlock = m_buffer + relativeLastSplitBlock;
             auto lastSplitBlockIndex = GetBlockIndex(level, lastSplitBlock);
 
             for (std::size_t index = 0; index <= lastSplitBlockIndex; ++index)
@@ -258,17 +520,21 @@ namespace IC
     }
 
     //------------------------------------------------------------------------------
-    std::size_t BuddyAllocator::GetBlockSize(std::size_t blockLevel) const noexcept
+    void BuddyAllocator::InitLevelTable() noexcept
     {
-        assert(blockLevel >= 0 && blockLevel < m_numBlockLevels);
-
-        auto output = m_bufferSize;
-        for (std::size_t level = 0; level < blockLevel; ++level)
+        if (m_blockLevelLookup == BlockLevelLookup::k_table)
         {
-            output >>= 1;
+            auto levelTableOffset = CalcFreeListTableSize(m_numBlockLevels) + 2 * CalcBlockDataTableSizeAligned(m_numBlockLevels);
+            m_levelTable = LevelTable(GetNumIndicesForLevel(m_numBlockLevels - 1), m_buffer + levelTableOffset);
         }
+    }
 
-        return output;
+    //------------------------------------------------------------------------------
+    std::size_t BuddyAllocator::GetBlockSize(std::size_t blockLevel) const noexcept
+    {
+        assert(blockLevel >= 0 && blockLevel < m_numBlockLevels);
+
+        return m_bufferSize >> blockLevel;
     }
 
     //------------------------------------------------------------------------------
@@ -285,11 +551,11 @@ namespace IC
     std::size_t BuddyAllocator::GetBlockIndex(std::size_t blockLevel, void* blockPointer) const noexcept
     {
         assert(blockLevel >= 0 && blockLevel < m_numBlockLevels);
-        assert(blockPointer >= m_buffer.get());
-        assert(MemoryUtils::GetPointerOffset(blockPointer, m_buffer.get()) < m_bufferSize);
-        assert(MemoryUtils::IsAligned(MemoryUtils::GetPointerOffset(blockPointer, m_buffer.get()), GetBlockSize(blockLevel)));
+        assert(blockPointer >= m_buffer);
+        assert(MemoryUtils::GetPointerOffset(blockPointer, m_buffer) < m_bufferSize);
+        assert(MemoryUtils::IsAligned(MemoryUtils::GetPointerOffset(blockPointer, m_buffer), GetBlockSize(blockLevel)));
 
-        auto pointerDiff = reinterpret_cast<std::uintptr_t>(blockPointer) - reinterpret_cast<std::uintptr_t>(m_buffer.get());
+        auto pointerDiff = reinterpret_cast<std::uintptr_t>(blockPointer) - reinterpret_cast<std::uintptr_t>(m_buffer);
         return static_cast<std::size_t>(pointerDiff) / GetBlockSize(blockLevel);
     }
 
@@ -318,7 +584,7 @@ namespace IC
         assert(blockLevel >= 0 && blockLevel < m_numBlockLevels);
         assert(blockIndex < GetNumIndicesForLevel(blockLevel));
 
-        return reinterpret_cast<void*>(m_buffer.get() + blockIndex * GetBlockSize(blockLevel));
+        return reinterpret_cast<void*>(m_buffer + blockIndex * GetBlockSize(blockLevel));
     }
 
     //------------------------------------------------------------------------------
@@ -326,12 +592,21 @@ namespace IC
     {
         assert(blockPointer);
 
+        if (m_blockLevelLookup == BlockLevelLookup::k_table)
+        {
+            out_level = m_levelTable.GetLevel(GetBlockIndex(m_numBlockLevels - 1, blockPointer));
+            out_index = GetBlockIndex(out_level, blockPointer);
+
+            assert(out_level != 0);
+            return;
+        }
+
         out_level = 0;
         out_index = 0;
 
         for (std::size_t level = 1; level < m_numBlockLevels; ++level)
         {
-            if (MemoryUtils::IsAligned(MemoryUtils::GetPointerOffset(blockPointer, m_buffer.get()), GetBlockSize(level)))
+            if (MemoryUtils::IsAligned(MemoryUtils::GetPointerOffset(blockPointer, m_buffer), GetBlockSize(level)))
             {
                 auto index = GetBlockIndex(level, blockPointer);
 
@@ -347,11 +622,26 @@ namespace IC
         assert(out_level != 0);
     }
 
+    //------------------------------------------------------------------------------
+    std::unique_lock<std::mutex> BuddyAllocator::LockLevel(std::size_t blockLevel) noexcept
+    {
+        assert(blockLevel < m_numBlockLevels);
+
+        if (m_lockingMode == LockingMode::k_perLevel)
+        {
+            return std::unique_lock<std::mutex>(m_levelMutexes[blockLevel]);
+        }
+
+        return std::unique_lock<std::mutex>();
+    }
+
     //------------------------------------------------------------------------------
     void BuddyAllocator::SplitBlock(std::size_t blockLevel) noexcept
     {
         assert(blockLevel > 0 && blockLevel < m_numBlockLevels - 1);
 
+        auto levelLock = LockLevel(blockLevel);
+
         auto blockPointer = m_freeListTable.GetStart(blockLevel);
         if (!blockPointer)
         {
@@ -375,7 +665,7 @@ namespace IC
     }
 
     //------------------------------------------------------------------------------
-    void BuddyAllocator::TryMergeBlock(std::size_t blockLevel, std::size_t blockIndex) noexcept
+    void BuddyAllocator::TryMergeBlock(std::size_t blockLevel, std::size_t blockIndex, std::unique_lock<std::mutex>& childLevelLock) noexcept
     {
         assert(blockLevel >= 0 && blockLevel < m_numBlockLevels - 1);
 
@@ -388,6 +678,12 @@ namespace IC
             m_freeListTable.Remove(childBlockLevel, GetBlockPointer(childBlockLevel, childBlockIndexA));
             m_freeListTable.Remove(childBlockLevel, GetBlockPointer(childBlockLevel, childBlockIndexB));
 
+            auto levelLock = LockLevel(blockLevel);
+            if (childLevelLock.owns_lock())
+            {
+                childLevelLock.unlock();
+            }
+
             m_splitTable.SetSplit(blockLevel, blockIndex, false);
             m_allocatedTable.ToggleAllocatedFlag(blockLevel, blockIndex);
 
@@ -397,7 +693,7 @@ namespace IC
             if (parentLevel > 0)
             {
                 std::size_t parentIndex = GetParentBlockIndex(blockLevel, blockIndex);
-                TryMergeBlock(parentLevel, parentIndex);
+                TryMergeBlock(parentLevel, parentIndex, levelLock);
             }
         }
     }
@@ -499,9 +795,8 @@ namespace IC
         auto tableLevel = blockLevel - 1;
         auto tableIndex = blockIndex >> 1;
 
-        auto flagIndex = (1 << tableLevel) - 1 + tableIndex;
-        auto flagByteIndex = flagIndex / CHAR_BIT;
-        auto flagBitIndex = flagIndex % CHAR_BIT;
+        auto flagByteIndex = CalcBlockDataTableLevelOffset(tableLevel) + tableIndex / CHAR_BIT;
+        auto flagBitIndex = tableIndex % CHAR_BIT;
 
         return (reinterpret_cast<std::uint8_t*>(m_allocatedTable)[flagByteIndex] & (1 << flagBitIndex)) != 0;
     }
@@ -515,9 +810,8 @@ namespace IC
         auto tableLevel = blockLevel - 1;
         auto tableIndex = blockIndex >> 1;
 
-        auto flagIndex = (1 << tableLevel) - 1 + tableIndex;
-        auto flagByteIndex = flagIndex / CHAR_BIT;
-        auto flagBitIndex = flagIndex % CHAR_BIT;
+        auto flagByteIndex = CalcBlockDataTableLevelOffset(tableLevel) + tableIndex / CHAR_BIT;
+        auto flagBitIndex = tableIndex % CHAR_BIT;
 
         reinterpret_cast<std::uint8_t*>(m_allocatedTable)[flagByteIndex] ^= (1 << flagBitIndex);
     }
@@ -526,7 +820,9 @@ namespace IC
     BuddyAllocator::SplitTable::SplitTable(std::size_t numBlockLevels, void* buffer) noexcept
         : m_numBlockLevels(numBlockLevels), m_splitTable(buffer)
     {
-        memset(m_splitTable, 0, CalcBlockDataTableSizeAligned(numBlockLevels));
+        // The split table has one fewer level than the allocator, so the size must be calculated
+        // from the full number of levels.
+        memset(m_splitTable, 0, CalcBlockDataTableSizeAligned(numBlockLevels + 1));
     }
 
     //------------------------------------------------------------------------------
@@ -535,9 +831,8 @@ namespace IC
         assert(blockLevel >= 0 && blockLevel < m_numBlockLevels);
         assert(blockIndex < GetNumIndicesForLevel(blockLevel));
 
-        auto flagIndex = (1 << blockLevel) - 1 + blockIndex;
-        auto flagByteIndex = flagIndex / CHAR_BIT;
-        auto flagBitIndex = flagIndex % CHAR_BIT;
+        auto flagByteIndex = CalcBlockDataTableLevelOffset(blockLevel) + blockIndex / CHAR_BIT;
+        auto flagBitIndex = blockIndex % CHAR_BIT;
 
         return (reinterpret_cast<std::uint8_t*>(m_splitTable)[flagByteIndex] & (1 << flagBitIndex)) != 0;
     }
@@ -548,9 +843,8 @@ namespace IC
         assert(blockLevel >= 0 && blockLevel < m_numBlockLevels);
         assert(blockIndex < GetNumIndicesForLevel(blockLevel));
 
-        auto bufferBlockIndex = (1 << blockLevel) - 1 + blockIndex;
-        auto bufferByteIndex = bufferBlockIndex / CHAR_BIT;
-        auto bufferBitIndex = bufferBlockIndex % CHAR_BIT;
+        auto bufferByteIndex = CalcBlockDataTableLevelOffset(blockLevel) + blockIndex / CHAR_BIT;
+        auto bufferBitIndex = blockIndex % CHAR_BIT;
 
         if (isSplit)
         {
@@ -562,9 +856,41 @@ namespace IC
         }
     }
 
+    //------------------------------------------------------------------------------
+    BuddyAllocator::LevelTable::LevelTable(std::size_t numMinBlocks, void* buffer) noexcept
+        : m_numMinBlocks(numMinBlocks), m_levelTable(reinterpret_cast<std::uint8_t*>(buffer))
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t BuddyAllocator::LevelTable::GetLevel(std::size_t minBlockIndex) const noexcept
+    {
+        assert(minBlockIndex < m_numMinBlocks);
+
+        return static_cast<std::size_t>(m_levelTable[minBlockIndex]);
+    }
+
+    //------------------------------------------------------------------------------
+    void BuddyAllocator::LevelTable::SetLevel(std::size_t minBlockIndex, std::size_t blockLevel) noexcept
+    {
+        assert(minBlockIndex < m_numMinBlocks);
+        assert(blockLevel <= UINT8_MAX);
+
+        m_levelTable[minBlockIndex] = static_cast<std::uint8_t>(blockLevel);
+    }
+
     //------------------------------------------------------------------------------
     BuddyAllocator::~BuddyAllocator() noexcept
     {
         assert(m_allocationCount == 0);
+
+        if (m_parentAllocator)
+        {
+            m_parentAllocator->Deallocate(m_buffer);
+        }
+        else
+        {
+            MemoryUtils::DeallocateAligned(m_buffer);
+        }
     }
 }
\ No newline at end of file
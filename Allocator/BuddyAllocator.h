@@ -27,6 +27,7 @@
 
 #include "IAllocator.h"
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 
@@ -52,18 +53,76 @@ namespace IC
     /// http://bitsquid.blogspot.co.uk/2015/08/allocation-adventures-3-buddy-allocator.html
     ///
     /// The buddy allocator is thread-safe, however it requires locking to acheive this.
+    /// By default a single mutex guards the whole buffer. Alternatively, each level can
+    /// be given its own mutex so that allocations and deallocations of different sizes
+    /// don't serialise; see LockingMode.
     ///
     class BuddyAllocator final : public IAllocator
     {
     public:
+        /// Describes how the level of a block is found when it is deallocated.
+        ///
+        /// k_search:    The levels are searched using the split table. This requires no
+        ///              additional memory, but deallocation is O(levels).
+        /// k_table:     The level of each allocated block is stored in a table, containing
+        ///              one byte for each minimum size block, in the buffer header. This
+        ///              makes deallocation O(1).
+        ///
+        enum class BlockLevelLookup
+        {
+            k_search,
+            k_table
+        };
+
+        /// Describes how the allocator is made thread-safe.
+        ///
+        /// k_global:    A single mutex is held for the duration of each allocation and
+        ///              deallocation.
+        /// k_perLevel:  Each level has its own mutex, guarding the free list and table
+        ///              entries for that level. Splitting and merging acquire the mutex of
+        ///              each level they touch, always in order from the smallest block
+        ///              level towards the root, so they cannot deadlock. This requires
+        ///              the k_table block level lookup.
+        ///
+        enum class LockingMode
+        {
+            k_global,
+            k_perLevel
+        };
+
         /// Constructs a new allocator of the given size.
         ///
         /// @param bufferSize
         ///     The size of the buffer. This must be a power of two.
         /// @param minBlockSize
         ///        The minimum block size. This must be a power of two.
+        /// @param blockLevelLookup
+        ///     How the level of a block is found when it is deallocated. Defaults to
+        ///     k_search.
+        /// @param lockingMode
+        ///     How the allocator is made thread-safe. Defaults to k_global.
+        ///
+        BuddyAllocator(std::size_t bufferSize, std::size_t minBlockSize = 64, BlockLevelLookup blockLevelLookup = BlockLevelLookup::k_search, 
+            LockingMode lockingMode = LockingMode::k_global) noexcept;
+
+        /// Constructs a new allocator of the given size, with the buffer allocated from
+        /// the given parent allocator. The parent allocator must support allocations 
+        /// aligned to GetMaxAlignment().
+        ///
+        /// @param parentAllocator
+        ///     The allocator from which the buffer will be allocated.
+        /// @param bufferSize
+        ///     The size of the buffer. This must be a power of two.
+        /// @param minBlockSize
+        ///        The minimum block size. This must be a power of two.
+        /// @param blockLevelLookup
+        ///     How the level of a block is found when it is deallocated. Defaults to
+        ///     k_search.
+        /// @param lockingMode
+        ///     How the allocator is made thread-safe. Defaults to k_global.
         ///
-        BuddyAllocator(std::size_t bufferSize, std::size_t minBlockSize = 64) noexcept;
+        BuddyAllocator(IAllocator& parentAllocator, std::size_t bufferSize, std::size_t minBlockSize = 64, BlockLevelLookup blockLevelLookup = BlockLevelLookup::k_search, 
+            LockingMode lockingMode = LockingMode::k_global) noexcept;
 
         /// This thread-safe.
         ///
@@ -72,6 +131,14 @@ namespace IC
         ///
         std::size_t GetMaxAllocationSize() const noexcept override { return GetBufferSize() / 2; }
 
+        /// This thread-safe.
+        ///
+        /// @return The maximum alignment which can be requested from this allocator. The
+        /// buffer is aligned to its own size, up to 64 KiB, and each block is aligned
+        /// to its size relative to the buffer.
+        ///
+        std::size_t GetMaxAlignment() const noexcept;
+
         /// This thread-safe.
         ///
         /// @return The size of the buffer. 
@@ -96,6 +163,21 @@ namespace IC
         ///
         void* Allocate(std::size_t allocationSize) noexcept override;
 
+        /// Allocates a new block of memory of the requested size and alignment. As blocks 
+        /// are naturally aligned, this simply uses a block which is at least as large as
+        /// the alignment. The alignment must not exceed GetMaxAlignment().
+        /// 
+        /// This is thread-safe, though it will require locking.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
         /// Deallocates the given memory, returning the memory block to the free list. If
         /// appropriate the block will be re-merged with its buddy.
         /// 
@@ -106,6 +188,60 @@ namespace IC
         ///
         void Deallocate(void* pointer) noexcept override;
 
+        /// Deallocates the given memory, using the allocation size to find the level of
+        /// the block rather than looking it up. If appropriate the block will be re-merged
+        /// with its buddy.
+        /// 
+        /// This is thread-safe, though it will require locking.
+        ///
+        /// @param pointer
+        ///     The memory which is to be freed.
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        void Deallocate(void* pointer, std::size_t allocationSize) noexcept override;
+
+        /// Attempts to resize the given block without moving it. If the new size requires
+        /// a smaller block, the block is split and the unused halves are returned to the
+        /// free lists. If the new size requires a larger block, the block is merged with
+        /// its buddies, which is only possible if the block is the first of each buddy pair
+        /// and each of the buddies is free.
+        ///
+        /// This is thread-safe, though it will require locking.
+        ///
+        /// @param pointer
+        ///     The block which should be resized.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return Whether or not the block was resized.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
+        /// Deallocates each of the given blocks, as if Deallocate() had been called for
+        /// each. When using global locking the mutex is only acquired once for the whole
+        /// batch.
+        /// 
+        /// This is thread-safe, though it will require locking.
+        ///
+        /// @param pointers
+        ///     The array of pointers to the memory which is to be freed.
+        /// @param numPointers
+        ///     The number of pointers in the array.
+        ///
+        void DeallocateBatch(void* const* pointers, std::size_t numPointers) noexcept;
+
+        /// This is thread-safe. If the k_search block level lookup is in use this will
+        /// require locking.
+        ///
+        /// @param pointer
+        ///     A pointer to a currently allocated block.
+        ///
+        /// @return The size of the block which was allocated. This may be larger than
+        /// the allocation size which was requested.
+        ///
+        std::size_t GetAllocatedBlockSize(void* pointer) noexcept;
+
         ~BuddyAllocator() noexcept;
 
     private:
@@ -123,8 +259,9 @@ namespace IC
         /// each level in the free list table. Each element in the free list then stores
         /// the pointers to the previous and next elements.
         ///
-        /// This is not thread-safe, so the buddy allocator mutex should always be held
-        /// when calling any of the free list table's methods.
+        /// This is not thread-safe, so the buddy allocator mutex, or the mutex for the
+        /// requested level, should always be held when calling any of the free list
+        /// table's methods.
         ///
         class FreeListTable final
         {
@@ -220,8 +357,12 @@ namespace IC
         /// Note that this means that the block at level 0 does not have an entry as it 
         /// does not have a buddy. This block can be assumed to always be allocated.
         ///
-        /// This is not thread-safe, so the buddy allocator mutex should always be held
-        /// when calling any of the free list table's methods.
+        /// Each level starts on a new byte, so different levels can be safely accessed
+        /// while holding different level mutexes.
+        ///
+        /// This is not thread-safe, so the buddy allocator mutex, or the mutex for the
+        /// requested level, should always be held when calling any of the allocated
+        /// table's methods.
         ///
         class AllocatedTable final
         {
@@ -272,8 +413,12 @@ namespace IC
         /// Describes, for each possible parent, whether or not it is currently split
         /// into child buffers.
         ///
-        /// This is not thread-safe, so the buddy allocator mutex should always be held
-        /// when calling any of the free list table's methods.
+        /// Each level starts on a new byte, so different levels can be safely accessed
+        /// while holding different level mutexes.
+        ///
+        /// This is not thread-safe, so the buddy allocator mutex, or the mutex for the
+        /// requested level, should always be held when calling any of the split table's
+        /// methods.
         ///
         class SplitTable final
         {
@@ -321,6 +466,61 @@ namespace IC
             void* m_splitTable;
         };
 
+        /// Encapsulates functionality for accessing the level table. This requires no
+        /// memory, instead using the buffer provided in the constructor. This allows the
+        /// Buddy Allocator to use memory inside its buffer.
+        ///
+        /// A single byte is stored for each minimum size block in the buffer, describing
+        /// the level of the allocated block which starts at that address. Only entries
+        /// for the start of allocated blocks are valid; all others are ignored.
+        ///
+        /// This is not thread-safe. The entry for a block is written while the mutex
+        /// for its level is held, and only read when deallocating the block, at which
+        /// point the caller must already own it.
+        ///
+        class LevelTable final
+        {
+        public:
+            /// Constructs an empty level table.
+            ///
+            LevelTable() noexcept {}
+
+            /// Initialises the level table with the given memory buffer. The contents
+            /// of the buffer are not initialised as entries are always written when
+            /// a block is allocated, prior to them being read.
+            ///
+            /// @param numMinBlocks
+            ///     The number of minimum size blocks in the buffer.
+            /// @param buffer
+            ///     The buffer in which the level table should be stored.
+            ///
+            LevelTable(std::size_t numMinBlocks, void* buffer) noexcept;
+
+            /// This is not thread-safe.
+            ///
+            /// @param minBlockIndex
+            ///     The index of the allocated block in the lowest level.
+            ///
+            /// @return The level of the allocated block.
+            ///
+            std::size_t GetLevel(std::size_t minBlockIndex) const noexcept;
+
+            /// Sets the level of the allocated block.
+            ///
+            /// This is not thread-safe.
+            ///
+            /// @param minBlockIndex
+            ///     The index of the allocated block in the lowest level.
+            /// @param blockLevel
+            ///     The level of the allocated block.
+            ///
+            void SetLevel(std::size_t minBlockIndex, std::size_t blockLevel) noexcept;
+
+        private:
+            std::size_t m_numMinBlocks = 0;
+            std::uint8_t* m_levelTable = nullptr;
+        };
+
         /// Initialises the 'free' list table, which describes the first free block in any
         /// given level of the memory pool. Note that the pointers to the rest of the list
         /// are stored in the free block itself.
@@ -356,6 +556,16 @@ namespace IC
         ///
         void InitSplitTable() noexcept;
 
+        /// Initialises the level table, if the level table lookup is in use. This 
+        /// describes the level of each allocated block.
+        ///
+        /// For the sake of efficiency, this data is stored directly within the memory
+        /// buffer.
+        ///
+        /// This is not thread-safe and should only be called during construction.
+        ///
+        void InitLevelTable() noexcept;
+
         /// This is thread-safe.
         ///
         /// @param blockLevel
@@ -424,9 +634,11 @@ namespace IC
 
         /// Calculates both the level and index of the given allocated block pointer. 
         /// If the block is not allocated, or the pointer is not to a valid block, this
-        /// will assert.
+        /// will assert. If the level table is in use this is O(1), otherwise the split
+        /// table is searched.
         /// 
-        /// This is not thread-safe and should only be called while the mutex is held.
+        /// If the level table is in use this is thread-safe, otherwise it should only
+        /// be called while the mutex is held.
         ///
         /// @param blockPointer
         ///     The pointer to the block.
@@ -437,12 +649,51 @@ namespace IC
         ///
         void GetAllocatedBlockInfo(void* blockPointer, std::size_t& out_level, std::size_t& out_index) const noexcept;
 
+        /// Returns the given block to the free list, re-merging it with its buddy if
+        /// appropriate.
+        ///
+        /// This is not thread-safe and should only be called while the mutex is held,
+        /// or, if using per-level locking, while no level mutexes are held.
+        ///
+        /// @param blockPointer
+        ///     The block which is to be freed.
+        ///
+        void DeallocateBlock(void* blockPointer) noexcept;
+
+        /// Returns the given block to the free list, re-merging it with its buddy if
+        /// appropriate.
+        ///
+        /// This is not thread-safe and should only be called while the mutex is held,
+        /// or, if using per-level locking, while no level mutexes are held.
+        ///
+        /// @param blockPointer
+        ///     The block which is to be freed.
+        /// @param blockLevel
+        ///     The level of the block.
+        ///
+        void DeallocateBlock(void* blockPointer, std::size_t blockLevel) noexcept;
+
+        /// Locks the mutex for the given level if per-level locking is in use. If global
+        /// locking is in use the global mutex will already be held, so an empty lock is
+        /// returned.
+        ///
+        /// Level mutexes must always be acquired in order from the highest level index
+        /// to the lowest, i.e. from the smallest blocks towards the root.
+        ///
+        /// @param blockLevel
+        ///     The level to lock.
+        ///
+        /// @return The lock on the level mutex.
+        ///
+        std::unique_lock<std::mutex> LockLevel(std::size_t blockLevel) noexcept;
+
         /// Splits a block in the requested level into two blocks one level higher. If
         /// There are no available blocks at the requested level blocks will be split
         /// recursively at lower levels. If no block can be split after recursion then
         /// the memory pool has run out of memory and will assert.
         ///
-        /// This is not thread-safe and should only be called while the mutex is held.
+        /// This is not thread-safe and should only be called while the mutex, or the
+        /// mutex for the child level, is held. 
         ///
         /// @param blockLevel
         ///     The block level which should be split. Cannot be the lowest or highest
@@ -454,28 +705,38 @@ namespace IC
         /// merge its parent. This must only be called immediately after one of the
         /// blocks children have been returned to the free list.
         ///
-        /// This is not thread-safe and should only be called while the mutex is held.
+        /// This is not thread-safe and should only be called while the mutex, or the
+        /// mutex for the child level, is held. When using per-level locking, the child
+        /// level lock is released once the lock for this level has been acquired.
         ///
         /// @param blockLevel
         ///     The level of the block which should attempt to merge.
         /// @param blockIndex
         ///     The index of the block which should attempt to merge.
+        /// @param childLevelLock
+        ///     The lock on the child level mutex. Empty if using global locking.
         ///
-        void TryMergeBlock(std::size_t blockLevel, std::size_t blockIndex) noexcept;
+        void TryMergeBlock(std::size_t blockLevel, std::size_t blockIndex, std::unique_lock<std::mutex>& childLevelLock) noexcept;
 
         const std::size_t m_bufferSize;
         const std::size_t m_minBlockSize;
         const std::size_t m_numBlockLevels;
+        const BlockLevelLookup m_blockLevelLookup;
+        const LockingMode m_lockingMode;
         const std::size_t m_headerSize;
 
-        std::unique_ptr<std::uint8_t[]> m_buffer;
+        IAllocator* m_parentAllocator = nullptr;
+
+        std::uint8_t* m_buffer;
         FreeListTable m_freeListTable;
         AllocatedTable m_allocatedTable;
         SplitTable m_splitTable;
+        LevelTable m_levelTable;
 
         std::mutex m_mutex;
+        std::unique_ptr<std::mutex[]> m_levelMutexes;
 
-        std::size_t m_allocationCount;
+        std::atomic<std::size_t> m_allocationCount;
     };
 }
 
@@ -0,0 +1,157 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "BuddyAllocatorCache.h"
+
+#include "BuddyAllocator.h"
+#include "../Utility/MemoryUtils.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    BuddyAllocatorCache::BuddyAllocatorCache(BuddyAllocator& buddyAllocator, std::size_t maxCachedBlockSize, std::size_t magazineSize) noexcept
+        : m_buddyAllocator(&buddyAllocator),
+        m_maxCachedBlockSize(std::min(maxCachedBlockSize, buddyAllocator.GetMaxAllocationSize())),
+        m_magazineSize(magazineSize),
+        m_numMagazines(MemoryUtils::CalcShift(m_maxCachedBlockSize / buddyAllocator.GetMinBlockSize()) + 1)
+    {
+        assert(MemoryUtils::IsPowerOfTwo(m_maxCachedBlockSize));
+        assert(m_maxCachedBlockSize >= buddyAllocator.GetMinBlockSize());
+        assert(m_magazineSize >= 2);
+
+        m_magazines = std::unique_ptr<void*[]>(new void*[m_numMagazines * m_magazineSize]);
+        m_magazineCounts = std::unique_ptr<std::size_t[]>(new std::size_t[m_numMagazines]());
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t BuddyAllocatorCache::GetMaxAllocationSize() const noexcept
+    {
+        return m_buddyAllocator->GetMaxAllocationSize();
+    }
+
+    //------------------------------------------------------------------------------
+    void* BuddyAllocatorCache::Allocate(std::size_t allocationSize) noexcept
+    {
+        auto blockSize = MemoryUtils::Align(MemoryUtils::NextPowerofTwo(allocationSize), m_buddyAllocator->GetMinBlockSize());
+        if (blockSize > m_maxCachedBlockSize)
+        {
+            return m_buddyAllocator->Allocate(allocationSize);
+        }
+
+        auto magazineIndex = GetMagazineIndex(blockSize);
+        auto& count = m_magazineCounts[magazineIndex];
+        if (count > 0)
+        {
+            ++m_numHits;
+            return m_magazines[magazineIndex * m_magazineSize + --count];
+        }
+
+        ++m_numMisses;
+        return m_buddyAllocator->Allocate(allocationSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void* BuddyAllocatorCache::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+        assert(alignment <= m_buddyAllocator->GetMaxAlignment());
+
+        return Allocate(std::max(allocationSize, alignment));
+    }
+
+    //------------------------------------------------------------------------------
+    void BuddyAllocatorCache::Deallocate(void* pointer) noexcept
+    {
+        auto blockSize = m_buddyAllocator->GetAllocatedBlockSize(pointer);
+        if (blockSize > m_maxCachedBlockSize)
+        {
+            m_buddyAllocator->Deallocate(pointer, blockSize);
+            return;
+        }
+
+        CacheBlock(pointer, blockSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void BuddyAllocatorCache::Deallocate(void* pointer, std::size_t allocationSize) noexcept
+    {
+        auto blockSize = MemoryUtils::Align(MemoryUtils::NextPowerofTwo(allocationSize), m_buddyAllocator->GetMinBlockSize());
+        if (blockSize > m_maxCachedBlockSize)
+        {
+            m_buddyAllocator->Deallocate(pointer, allocationSize);
+            return;
+        }
+
+        CacheBlock(pointer, blockSize);
+    }
+
+    //------------------------------------------------------------------------------
+    bool BuddyAllocatorCache::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        return m_buddyAllocator->TryResizeInPlace(pointer, newSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void BuddyAllocatorCache::CacheBlock(void* pointer, std::size_t blockSize) noexcept
+    {
+        auto magazineIndex = GetMagazineIndex(blockSize);
+        auto magazine = m_magazines.get() + magazineIndex * m_magazineSize;
+        auto& count = m_magazineCounts[magazineIndex];
+        if (count == m_magazineSize)
+        {
+            auto numToFlush = m_magazineSize / 2;
+            m_buddyAllocator->DeallocateBatch(magazine, numToFlush);
+
+            std::copy(magazine + numToFlush, magazine + count, magazine);
+            count -= numToFlush;
+        }
+
+        magazine[count++] = pointer;
+    }
+
+    //------------------------------------------------------------------------------
+    void BuddyAllocatorCache::Flush() noexcept
+    {
+        for (std::size_t magazineIndex = 0; magazineIndex < m_numMagazines; ++magazineIndex)
+        {
+            m_buddyAllocator->DeallocateBatch(m_magazines.get() + magazineIndex * m_magazineSize, m_magazineCounts[magazineIndex]);
+            m_magazineCounts[magazineIndex] = 0;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t BuddyAllocatorCache::GetMagazineIndex(std::size_t blockSize) const noexcept
+    {
+        assert(blockSize <= m_maxCachedBlockSize);
+
+        return MemoryUtils::CalcShift(blockSize / m_buddyAllocator->GetMinBlockSize());
+    }
+
+    //------------------------------------------------------------------------------
+    BuddyAllocatorCache::~BuddyAllocatorCache() noexcept
+    {
+        Flush();
+    }
+}
@@ -0,0 +1,188 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORY_ALLOCATOR_BUDDYALLOCATORCACHE_H_
+#define _ICMEMORY_ALLOCATOR_BUDDYALLOCATORCACHE_H_
+
+#include "IAllocator.h"
+
+#include <memory>
+
+namespace IC
+{
+    /// A caching front-end for a BuddyAllocator, intended to be owned by a single thread.
+    /// Deallocated blocks are kept in a "magazine" for their block level rather than
+    /// being returned to the buddy allocator, and are handed straight back out when a
+    /// block of the same level is next allocated. Cache hits don't touch the buddy
+    /// allocator's free lists or mutexes.
+    ///
+    /// When a magazine overflows, the older half of it is returned to the buddy
+    /// allocator in a single batch. All cached blocks are returned when the cache is
+    /// flushed or destroyed, so a cache owned by a thread, for example as a thread_local,
+    /// will return its blocks when the thread exits.
+    ///
+    /// Blocks held in a magazine remain allocated from the point of view of the buddy
+    /// allocator, so they cannot be merged with their buddies until flushed. Only blocks
+    /// up to the given maximum size are cached; larger allocations are passed straight
+    /// through.
+    ///
+    /// Looking up the size of a deallocated block is only lock-free if the buddy
+    /// allocator uses the k_table block level lookup, so this should typically be used.
+    ///
+    /// This is not thread-safe and should not be accessed from multiple threads at the
+    /// same time. The cache must be destroyed before the buddy allocator.
+    ///
+    class BuddyAllocatorCache final : public IAllocator
+    {
+    public:
+        static constexpr std::size_t k_defaultMaxCachedBlockSize = 4 * 1024;
+        static constexpr std::size_t k_defaultMagazineSize = 32;
+
+        /// Creates a new cache in front of the given buddy allocator.
+        ///
+        /// @param buddyAllocator
+        ///     The buddy allocator from which blocks are allocated.
+        /// @param maxCachedBlockSize
+        ///     Optional. The largest block size which will be cached. Defaults to
+        ///     k_defaultMaxCachedBlockSize.
+        /// @param magazineSize
+        ///     Optional. The maximum number of blocks cached for each block level. Must
+        ///     be at least 2. Defaults to k_defaultMagazineSize.
+        ///
+        BuddyAllocatorCache(BuddyAllocator& buddyAllocator, std::size_t maxCachedBlockSize = k_defaultMaxCachedBlockSize, std::size_t magazineSize = k_defaultMagazineSize) noexcept;
+
+        /// @return The maximum allocation size from this allocator. This is the same as
+        /// the underlying buddy allocator.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override;
+
+        /// @return The number of allocations which were served from the cache.
+        ///
+        std::size_t GetNumHits() const noexcept { return m_numHits; }
+
+        /// @return The number of cacheable allocations which had to be allocated from
+        /// the buddy allocator.
+        ///
+        std::size_t GetNumMisses() const noexcept { return m_numMisses; }
+
+        /// Allocates a new block of memory of the requested size. If a block of the
+        /// required level is in the cache it will be used, otherwise it is allocated
+        /// from the buddy allocator.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Allocates a block of at least the requested size and alignment. As buddy blocks
+        /// are naturally aligned, this is the same as allocating a block which is at least
+        /// as large as the alignment.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two, no greater than
+        ///     the buddy allocator's maximum alignment.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
+        /// Deallocates the given memory, adding it to the cache if it is small enough.
+        /// If the magazine for the block level is full, the older half of the magazine
+        /// will first be returned to the buddy allocator.
+        ///
+        /// @param pointer
+        ///     The memory which is to be freed. This must have been allocated from
+        ///     the underlying buddy allocator.
+        ///
+        void Deallocate(void* pointer) noexcept override;
+
+        /// Returns the given block to the magazine for its size, as with Deallocate(), but
+        /// uses the allocation size to find the block size rather than querying the buddy
+        /// allocator.
+        ///
+        /// @param pointer
+        ///     The memory which is to be freed.
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        void Deallocate(void* pointer, std::size_t allocationSize) noexcept override;
+
+        /// Attempts to resize the given block without moving it. This is passed straight
+        /// through to the buddy allocator.
+        ///
+        /// @param pointer
+        ///     The block which should be resized.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return Whether or not the block was resized.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
+        /// Returns all cached blocks to the buddy allocator.
+        ///
+        void Flush() noexcept;
+
+        ~BuddyAllocatorCache() noexcept;
+
+    private:
+        BuddyAllocatorCache(BuddyAllocatorCache&) = delete;
+        BuddyAllocatorCache& operator=(BuddyAllocatorCache&) = delete;
+        BuddyAllocatorCache(BuddyAllocatorCache&&) = delete;
+        BuddyAllocatorCache& operator=(BuddyAllocatorCache&&) = delete;
+
+        /// @param blockSize
+        ///     The block size. Must be a power of two and at least the minimum block
+        ///     size of the buddy allocator.
+        ///
+        /// @return The index of the magazine for the given block size.
+        ///
+        std::size_t GetMagazineIndex(std::size_t blockSize) const noexcept;
+
+        /// Adds the given block to the magazine for its size. If the magazine is full, the
+        /// older half is first returned to the buddy allocator.
+        ///
+        /// @param pointer
+        ///     The block which is to be cached.
+        /// @param blockSize
+        ///     The size of the block. Must not exceed the max cached block size.
+        ///
+        void CacheBlock(void* pointer, std::size_t blockSize) noexcept;
+
+        BuddyAllocator* m_buddyAllocator;
+        const std::size_t m_maxCachedBlockSize;
+        const std::size_t m_magazineSize;
+        const std::size_t m_numMagazines;
+
+        std::unique_ptr<void*[]> m_magazines;
+        std::unique_ptr<std::size_t[]> m_magazineCounts;
+
+        std::size_t m_numHits = 0;
+        std::size_t m_numMisses = 0;
+    };
+}
+
+#endif
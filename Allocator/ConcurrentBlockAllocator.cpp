@@ -0,0 +1,241 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "ConcurrentBlockAllocator.h"
+#include "BlockAllocator.h"
+#include "../Utility/MemoryUtils.h"
+
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    ConcurrentBlockAllocator::ConcurrentBlockAllocator(std::size_t blockSize, std::size_t numBlocks) noexcept
+        : m_blockSize(blockSize), m_numBlocks(numBlocks), m_bufferSize(m_blockSize * m_numBlocks), 
+        m_freeBlockListHead(PackHead(k_nullIndex, 0)), m_numInitialisedBlocks(0), m_numAllocatedBlocks(0)
+    {
+        assert(MemoryUtils::IsAligned(blockSize, sizeof(std::intptr_t)));
+        assert(blockSize >= sizeof(FreeBlock));
+        assert(numBlocks < k_nullIndex);
+
+        m_buffer = reinterpret_cast<std::uint8_t*>(MemoryUtils::AllocateAligned(m_bufferSize, BlockAllocator::CalcBufferAlignment(m_blockSize)));
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentBlockAllocator::ConcurrentBlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocks) noexcept
+        : m_blockSize(blockSize), m_numBlocks(numBlocks), m_bufferSize(m_blockSize * m_numBlocks), m_parentAllocator(&parentAllocator),
+        m_freeBlockListHead(PackHead(k_nullIndex, 0)), m_numInitialisedBlocks(0), m_numAllocatedBlocks(0)
+    {
+        assert(MemoryUtils::IsAligned(blockSize, sizeof(std::intptr_t)));
+        assert(blockSize >= sizeof(FreeBlock));
+        assert(numBlocks < k_nullIndex);
+
+        m_buffer = reinterpret_cast<std::uint8_t*>(m_parentAllocator->Allocate(m_bufferSize, BlockAllocator::CalcBufferAlignment(m_blockSize)));
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentBlockAllocator::ConcurrentBlockAllocator(void* buffer, std::size_t blockSize, std::size_t numBlocks) noexcept
+        : m_blockSize(blockSize), m_numBlocks(numBlocks), m_bufferSize(m_blockSize * m_numBlocks), m_isBufferOwned(false), 
+        m_buffer(reinterpret_cast<std::uint8_t*>(buffer)), m_freeBlockListHead(PackHead(k_nullIndex, 0)), m_numInitialisedBlocks(0), m_numAllocatedBlocks(0)
+    {
+        assert(MemoryUtils::IsAligned(blockSize, sizeof(std::intptr_t)));
+        assert(blockSize >= sizeof(FreeBlock));
+        assert(numBlocks < k_nullIndex);
+        assert(m_buffer);
+        assert(MemoryUtils::IsAligned(reinterpret_cast<std::uintptr_t>(m_buffer), BlockAllocator::CalcBufferAlignment(m_blockSize)));
+    }
+
+    //------------------------------------------------------------------------------
+    void* ConcurrentBlockAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        assert(allocationSize <= m_blockSize);
+
+        m_numAllocatedBlocks.fetch_add(1, std::memory_order_relaxed);
+
+        auto head = m_freeBlockListHead.load(std::memory_order_acquire);
+        while (static_cast<std::uint32_t>(head) != k_nullIndex)
+        {
+            auto block = GetBlock(static_cast<std::uint32_t>(head));
+            auto next = block->m_next.load(std::memory_order_relaxed);
+            auto newHead = PackHead(next, static_cast<std::uint32_t>(head >> 32) + 1);
+
+            if (m_freeBlockListHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                return block;
+            }
+        }
+
+        auto index = m_numInitialisedBlocks.fetch_add(1, std::memory_order_relaxed);
+        assert(index < m_numBlocks);
+
+        return m_buffer + m_blockSize * index;
+    }
+
+    //------------------------------------------------------------------------------
+    void* ConcurrentBlockAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+        assert(MemoryUtils::IsAligned(m_blockSize, alignment));
+        assert(MemoryUtils::IsAligned(reinterpret_cast<std::uintptr_t>(m_buffer), alignment));
+
+        return Allocate(allocationSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentBlockAllocator::Deallocate(void* pointer) noexcept
+    {
+        assert(ContainsBlock(pointer));
+
+        auto index = static_cast<std::uint32_t>(MemoryUtils::GetPointerOffset(pointer, m_buffer) / m_blockSize);
+        auto block = reinterpret_cast<FreeBlock*>(pointer);
+
+        auto head = m_freeBlockListHead.load(std::memory_order_relaxed);
+        std::uint64_t newHead;
+        do
+        {
+            block->m_next.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+            newHead = PackHead(index, static_cast<std::uint32_t>(head >> 32) + 1);
+        }
+        while (!m_freeBlockListHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+
+        m_numAllocatedBlocks.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentBlockAllocator::AllocateBatch(std::size_t allocationSize, std::size_t numBlocks, void** out_blocks) noexcept
+    {
+        assert(allocationSize <= m_blockSize);
+        assert(out_blocks || numBlocks == 0);
+
+        m_numAllocatedBlocks.fetch_add(numBlocks, std::memory_order_relaxed);
+
+        std::size_t numAllocated = 0;
+        auto head = m_freeBlockListHead.load(std::memory_order_acquire);
+        while (numAllocated < numBlocks && static_cast<std::uint32_t>(head) != k_nullIndex)
+        {
+            auto block = GetBlock(static_cast<std::uint32_t>(head));
+            auto next = block->m_next.load(std::memory_order_relaxed);
+            auto newHead = PackHead(next, static_cast<std::uint32_t>(head >> 32) + 1);
+
+            if (m_freeBlockListHead.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                out_blocks[numAllocated++] = block;
+                head = newHead;
+            }
+        }
+
+        if (numAllocated < numBlocks)
+        {
+            auto index = m_numInitialisedBlocks.fetch_add(numBlocks - numAllocated, std::memory_order_relaxed);
+            assert(index + (numBlocks - numAllocated) <= m_numBlocks);
+
+            while (numAllocated < numBlocks)
+            {
+                out_blocks[numAllocated++] = m_buffer + m_blockSize * index++;
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentBlockAllocator::DeallocateBatch(void* const* pointers, std::size_t numPointers) noexcept
+    {
+        assert(pointers || numPointers == 0);
+
+        if (numPointers == 0)
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i < numPointers; ++i)
+        {
+            assert(ContainsBlock(pointers[i]));
+
+            if (i + 1 < numPointers)
+            {
+                auto nextIndex = static_cast<std::uint32_t>(MemoryUtils::GetPointerOffset(pointers[i + 1], m_buffer) / m_blockSize);
+                reinterpret_cast<FreeBlock*>(pointers[i])->m_next.store(nextIndex, std::memory_order_relaxed);
+            }
+        }
+
+        auto firstIndex = static_cast<std::uint32_t>(MemoryUtils::GetPointerOffset(pointers[0], m_buffer) / m_blockSize);
+        auto last = reinterpret_cast<FreeBlock*>(pointers[numPointers - 1]);
+
+        auto head = m_freeBlockListHead.load(std::memory_order_relaxed);
+        std::uint64_t newHead;
+        do
+        {
+            last->m_next.store(static_cast<std::uint32_t>(head), std::memory_order_relaxed);
+            newHead = PackHead(firstIndex, static_cast<std::uint32_t>(head >> 32) + 1);
+        }
+        while (!m_freeBlockListHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+
+        m_numAllocatedBlocks.fetch_sub(numPointers, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    bool ConcurrentBlockAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        assert(ContainsBlock(pointer));
+
+        return newSize <= m_blockSize;
+    }
+
+    //------------------------------------------------------------------------------
+    bool ConcurrentBlockAllocator::ContainsBlock(void* block) const noexcept
+    {
+        return (block >= m_buffer && block < m_buffer + m_bufferSize);
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint64_t ConcurrentBlockAllocator::PackHead(std::uint32_t index, std::uint32_t tag) noexcept
+    {
+        return (static_cast<std::uint64_t>(tag) << 32) | index;
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentBlockAllocator::FreeBlock* ConcurrentBlockAllocator::GetBlock(std::uint32_t index) const noexcept
+    {
+        assert(index < m_numBlocks);
+
+        return reinterpret_cast<FreeBlock*>(m_buffer + m_blockSize * index);
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentBlockAllocator::~ConcurrentBlockAllocator() noexcept
+    {
+        assert(m_numAllocatedBlocks == 0);
+
+        if (!m_isBufferOwned)
+        {
+            return;
+        }
+
+        if (m_parentAllocator)
+        {
+            m_parentAllocator->Deallocate(m_buffer);
+        }
+        else
+        {
+            MemoryUtils::DeallocateAligned(m_buffer);
+        }
+    }
+}
@@ -0,0 +1,265 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORY_ALLOCATOR_CONCURRENTBLOCKALLOCATOR_H_
+#define _ICMEMORY_ALLOCATOR_CONCURRENTBLOCKALLOCATOR_H_
+
+#include "IAllocator.h"
+
+#include <atomic>
+
+namespace IC
+{
+    /// A thread-safe version of the BlockAllocator. This allocates fixed size memory 
+    /// blocks from a fixed size buffer, and can be accessed from multiple threads at
+    /// the same time without locking.
+    ///
+    /// Free blocks are stored in a lock-free stack. The head of the stack contains
+    /// both the index of the first free block and a tag which is incremented on every
+    /// change, which prevents the ABA problem. As with BlockAllocator, blocks which have
+    /// never been allocated are handed out in order from a high-water mark, so the
+    /// buffer is not touched on construction.
+    ///
+    /// The number of blocks must be less than 2^32 - 1.
+    ///
+    class ConcurrentBlockAllocator final : public IAllocator
+    {
+    public:
+        /// Creates a new ConcurrentBlockAllocator with a buffer allocated from the free
+        /// store.
+        ///
+        /// @param blockSize
+        ///        The size of each block in the allocator. The block size must be multiple
+        ///        of the size of a pointer, and at least the size of a pointer.
+        /// @param numBlocks
+        ///        The number of blocks available to the block allocator.
+        /// 
+        ConcurrentBlockAllocator(std::size_t blockSize, std::size_t numBlocks) noexcept;
+
+        /// Creates a new ConcurrentBlockAllocator with a buffer allocated from the given
+        /// allocator.
+        ///
+        /// @param allocator
+        ///        The allocator from which to allocate the block buffer.
+        /// @param blockSize
+        ///        The size of each block in the allocator. The block size must be multiple
+        ///        of the size of a pointer, and at least the size of a pointer.
+        /// @param numBlocks
+        ///        The number of blocks available to the block allocator.
+        /// 
+        ConcurrentBlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocks) noexcept;
+
+        /// Creates a new ConcurrentBlockAllocator using the given buffer. The buffer must
+        /// be at least the block size multiplied by the number of blocks, and must be 
+        /// aligned to the buffer alignment for the block size. The buffer must outlive 
+        /// the allocator.
+        ///
+        /// @param buffer
+        ///        The buffer from which blocks will be allocated.
+        /// @param blockSize
+        ///        The size of each block in the allocator. The block size must be multiple
+        ///        of the size of a pointer, and at least the size of a pointer.
+        /// @param numBlocks
+        ///        The number of blocks available to the block allocator.
+        /// 
+        ConcurrentBlockAllocator(void* buffer, std::size_t blockSize, std::size_t numBlocks) noexcept;
+
+        /// This is thread-safe.
+        ///
+        /// @return The maximum allocation size from this allocator. Will be the size of a 
+        /// single block.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override { return GetBlockSize(); }
+
+        /// This is thread-safe.
+        ///
+        /// @return The size of each block in the buffer.
+        ///
+        std::size_t GetBlockSize() const noexcept { return m_blockSize; }
+
+        /// This is thread-safe.
+        ///
+        /// @return The total number of blocks available to the allocator.
+        ///
+        std::size_t GetNumBlocks() const noexcept { return m_numBlocks; }
+
+        /// This is thread-safe, though the value may be out of date by the time it is
+        /// used.
+        ///
+        /// @return The current number of allocated blocks in the allocator.
+        ///
+        std::size_t GetNumAllocatedBlocks() const noexcept { return m_numAllocatedBlocks.load(std::memory_order_relaxed); }
+
+        /// This is thread-safe, though the value may be out of date by the time it is
+        /// used.
+        ///
+        /// @return The current number of free blocks in the allocator.
+        ///
+        std::size_t GetNumFreeBlocks() const noexcept { return GetNumBlocks() - GetNumAllocatedBlocks(); }
+
+        /// Allocates a block from the allocator. The allocation size must be smaller than 
+        /// that of a block, otherwise this will assert. If there are no free blocks in the
+        /// buffer then this will assert.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param allocationSize
+        ///        The size of allocation required.
+        ///
+        /// @return The block of memory.
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Allocates a block from the allocator. The allocation size must be smaller than 
+        /// that of a block and every block must meet the requested alignment, otherwise 
+        /// this will assert. If there are no free blocks in the buffer then this will
+        /// assert.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param allocationSize
+        ///        The size of allocation required.
+        /// @param alignment
+        ///        The alignment required. Must be a power of two.
+        ///
+        /// @return The block of memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
+        /// Deallocates the given block, freeing it for reuse.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param pointer
+        ///        The pointer which should be deallocated.
+        ///
+        void Deallocate(void* pointer) noexcept override;
+
+        /// Allocates the given number of blocks from the allocator, as if Allocate() had
+        /// been called for each. Blocks are first popped from the free block list,
+        /// then the remainder are reserved from the blocks which have never been allocated
+        /// with a single atomic operation, so they are contiguous and in address order. If there are not enough free blocks in the buffer then
+        /// this will assert.
+        ///
+        /// This is thread-safe.
+        /// @param allocationSize
+        ///        The size of allocation required for each block.
+        /// @param numBlocks
+        ///        The number of blocks to allocate.
+        /// @param out_blocks
+        ///        (Out) The array the allocated blocks are written to. This must have space
+        ///        for at least numBlocks pointers.
+        ///
+        void AllocateBatch(std::size_t allocationSize, std::size_t numBlocks, void** out_blocks) noexcept;
+
+        /// Deallocates each of the given blocks, as if Deallocate() had been called for
+        /// each. The blocks are linked together locally and then
+        /// pushed to the free block list with a single compare-and-swap.
+        ///
+        /// This is thread-safe.
+        /// @param pointers
+        ///     The array of pointers to the blocks which are to be freed.
+        /// @param numPointers
+        ///     The number of pointers in the array.
+        ///
+        void DeallocateBatch(void* const* pointers, std::size_t numPointers) noexcept;
+
+        /// Resizing a block in place succeeds if the new size still fits in a single block.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param pointer
+        ///        The block which should be resized.
+        /// @param newSize
+        ///        The requested size of the allocation.
+        ///
+        /// @return Whether or not the new size fits in the block.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
+        /// Evaluates whether or not the given block pointer was allocated from this block
+        /// allocator.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param block
+        ///        The block pointer.
+        ///
+        /// @return Whether or not the block was allocated from this allocator.
+        ///
+        bool ContainsBlock(void* block) const noexcept;
+
+        ~ConcurrentBlockAllocator() noexcept;
+
+    private:
+        /// The header written into each free block. This contains the index of the next
+        /// free block, or k_nullIndex if this is the last.
+        ///
+        /// The next index can be read by one thread while another thread has popped the
+        /// block from the stack, so it is atomic. In that case the value read is never 
+        /// used, as the tag on the stack head will have changed.
+        ///
+        struct FreeBlock final
+        {
+            std::atomic<std::uint32_t> m_next;
+        };
+
+        static constexpr std::uint32_t k_nullIndex = 0xffffffff;
+
+        ConcurrentBlockAllocator(ConcurrentBlockAllocator&) = delete;
+        ConcurrentBlockAllocator& operator=(ConcurrentBlockAllocator&) = delete;
+        ConcurrentBlockAllocator(ConcurrentBlockAllocator&&) = delete;
+        ConcurrentBlockAllocator& operator=(ConcurrentBlockAllocator&&) = delete;
+
+        /// Packs the given block index and tag into a free list head value.
+        ///
+        /// @param index
+        ///     The index of the first free block, or k_nullIndex.
+        /// @param tag
+        ///     The tag.
+        ///
+        /// @return The packed free list head.
+        ///
+        static std::uint64_t PackHead(std::uint32_t index, std::uint32_t tag) noexcept;
+
+        /// @param index
+        ///     The index of the block.
+        ///
+        /// @return The block at the given index.
+        ///
+        FreeBlock* GetBlock(std::uint32_t index) const noexcept;
+
+        const std::size_t m_blockSize;
+        const std::size_t m_numBlocks;
+        const std::size_t m_bufferSize;
+
+        IAllocator* m_parentAllocator = nullptr;
+        bool m_isBufferOwned = true;
+
+        std::uint8_t* m_buffer = nullptr;
+        std::atomic<std::uint64_t> m_freeBlockListHead;
+        std::atomic<std::size_t> m_numInitialisedBlocks;
+        std::atomic<std::size_t> m_numAllocatedBlocks;
+    };
+}
+
+#endif
@@ -0,0 +1,148 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "ConcurrentLinearAllocator.h"
+
+#include "../Utility/MemoryUtils.h"
+
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    ConcurrentLinearAllocator::ConcurrentLinearAllocator(std::size_t bufferSize) noexcept
+        : m_bufferSize(bufferSize), m_nextOffset(0), m_activeAllocationCount(0)
+    {
+        m_buffer = reinterpret_cast<std::uint8_t*>(MemoryUtils::AllocateAligned(m_bufferSize, sizeof(std::intptr_t)));
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentLinearAllocator::ConcurrentLinearAllocator(IAllocator& parentAllocator, std::size_t bufferSize) noexcept
+        : m_bufferSize(bufferSize), m_parentAllocator(&parentAllocator), m_nextOffset(0), m_activeAllocationCount(0)
+    {
+        m_buffer = reinterpret_cast<std::uint8_t*>(m_parentAllocator->Allocate(m_bufferSize, sizeof(std::intptr_t)));
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentLinearAllocator::ConcurrentLinearAllocator(void* buffer, std::size_t bufferSize) noexcept
+        : m_bufferSize(bufferSize), m_isBufferOwned(false), m_buffer(reinterpret_cast<std::uint8_t*>(buffer)), m_nextOffset(0), m_activeAllocationCount(0)
+    {
+        assert(m_buffer);
+        assert(MemoryUtils::IsAligned(reinterpret_cast<std::uintptr_t>(m_buffer), sizeof(std::intptr_t)));
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t ConcurrentLinearAllocator::CalcReservedSize(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        // The offset is always pointer aligned, so at most alignment - sizeof(std::intptr_t)
+        // bytes of padding are needed to align the allocation.
+        auto padding = (alignment > sizeof(std::intptr_t)) ? alignment - sizeof(std::intptr_t) : 0;
+        return MemoryUtils::Align(allocationSize, sizeof(std::intptr_t)) + padding;
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t ConcurrentLinearAllocator::GetFreeSpace() const noexcept
+    {
+        auto nextOffset = m_nextOffset.load(std::memory_order_relaxed);
+        if (nextOffset >= m_bufferSize)
+        {
+            return 0;
+        }
+
+        return (m_bufferSize - nextOffset) & ~(sizeof(std::intptr_t) - 1);
+    }
+
+    //------------------------------------------------------------------------------
+    void* ConcurrentLinearAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        return Allocate(allocationSize, sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    void* ConcurrentLinearAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        auto output = TryAllocate(allocationSize, alignment);
+        assert(output);
+
+        return output;
+    }
+
+    //------------------------------------------------------------------------------
+    void* ConcurrentLinearAllocator::TryAllocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        auto reservedSize = CalcReservedSize(allocationSize, alignment);
+        auto offset = m_nextOffset.fetch_add(reservedSize, std::memory_order_relaxed);
+        if (offset > m_bufferSize || reservedSize > m_bufferSize - offset)
+        {
+            return nullptr;
+        }
+
+        m_activeAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+        return MemoryUtils::Align(m_buffer + offset, alignment);
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentLinearAllocator::Deallocate(void* pointer) noexcept
+    {
+        assert(Contains(pointer));
+
+        m_activeAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    bool ConcurrentLinearAllocator::Contains(void* pointer) const noexcept
+    {
+        return (pointer >= m_buffer && pointer < m_buffer + m_bufferSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentLinearAllocator::Reset() noexcept
+    {
+        assert(m_activeAllocationCount.load(std::memory_order_relaxed) == 0);
+
+        m_nextOffset.store(0, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentLinearAllocator::~ConcurrentLinearAllocator() noexcept
+    {
+        Reset();
+
+        if (m_isBufferOwned)
+        {
+            if (m_parentAllocator)
+            {
+                m_parentAllocator->Deallocate(m_buffer);
+            }
+            else
+            {
+                MemoryUtils::DeallocateAligned(m_buffer);
+            }
+        }
+
+        m_buffer = nullptr;
+    }
+}
@@ -0,0 +1,206 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef _ICMEMORY_ALLOCATOR_CONCURRENTLINEARALLOCATOR_H_
+#define _ICMEMORY_ALLOCATOR_CONCURRENTLINEARALLOCATOR_H_
+
+#include "IAllocator.h"
+
+#include <atomic>
+
+namespace IC
+{
+    /// A thread-safe version of the LinearAllocator. This allocates from a large buffer
+    /// by moving the next allocation offset through the buffer with a single atomic 
+    /// fetch-add, so it can be accessed from multiple threads at the same time without
+    /// locking. All allocations are 'deallocated' at the same time by resetting the 
+    /// allocation offset back to the start of the buffer.
+    ///
+    /// An allocation which doesn't fit still moves the allocation offset past the end of
+    /// the buffer, after which all further allocations will fail.
+    ///
+    /// Resetting and resizing allocations in place are not thread-safe, so unlike 
+    /// LinearAllocator resizing in place is not supported.
+    ///
+    /// A ConcurrentLinearAllocator can be backed by other allocator types, from which 
+    /// the buffer will be allocated, otherwise it's allocated from the free store.
+    ///
+    class ConcurrentLinearAllocator final : public IAllocator
+    {
+    public:
+        /// Initialises a new ConcurrentLinearAllocator with the given buffer size. The buffer
+        /// will be allocated from the free store.
+        ///
+        /// @param bufferSize
+        ///     The size of the buffer.
+        /// 
+        ConcurrentLinearAllocator(std::size_t bufferSize) noexcept;
+
+        /// Initialises a new ConcurrentLinearAllocator with the given buffer size. The buffer
+        /// will be allocated from the given parent allocator.
+        ///
+        /// @param parentAllocator
+        ///     The allocator from which the buffer will be allocated.
+        /// @param bufferSize
+        ///     The size of the buffer.
+        /// 
+        ConcurrentLinearAllocator(IAllocator& parentAllocator, std::size_t bufferSize) noexcept;
+
+        /// Initialises a new ConcurrentLinearAllocator using the given buffer. The buffer must
+        /// be aligned to the size of a pointer, and must outlive the allocator.
+        ///
+        /// @param buffer
+        ///     The buffer from which memory will be allocated.
+        /// @param bufferSize
+        ///     The size of the buffer.
+        /// 
+        ConcurrentLinearAllocator(void* buffer, std::size_t bufferSize) noexcept;
+
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The number of bytes which are reserved in the buffer for an allocation 
+        /// of the given size and alignment.
+        ///
+        static std::size_t CalcReservedSize(std::size_t allocationSize, std::size_t alignment) noexcept;
+
+        /// This thread-safe.
+        ///
+        /// @return The maximum allocation size from this allocator. This will always be 
+        /// the size of the buffer.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override { return GetBufferSize(); }
+
+        /// This thread-safe.
+        ///
+        /// @return The size of the buffer. 
+        ///
+        std::size_t GetBufferSize() const noexcept { return m_bufferSize; }
+
+        /// This is thread-safe, though the value may be out of date by the time it is
+        /// used.
+        ///
+        /// @return The number of bytes which are free in the buffer. 
+        ///
+        std::size_t GetFreeSpace() const noexcept;
+
+        /// This is thread-safe, though the value may be out of date by the time it is
+        /// used.
+        ///
+        /// @return The number of allocations which have not yet been deallocated.
+        ///
+        std::size_t GetNumActiveAllocations() const noexcept { return m_activeAllocationCount.load(std::memory_order_relaxed); }
+
+        /// Allocates a new block of memory of the requested size. If there is no space left in the
+        /// buffer for the alloaction then this will assert.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Allocates a new block of memory of the requested size and alignment. Enough space 
+        /// for the allocation to be aligned is reserved, so alignments larger than a pointer 
+        /// will waste some space. If there is no space left in the buffer for the alloaction
+        /// then this will assert.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
+        /// Allocates a new block of memory of the requested size and alignment, returning 
+        /// null rather than asserting if there is no space left in the buffer.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory, or null if it didn't fit.
+        ///
+        void* TryAllocate(std::size_t allocationSize, std::size_t alignment) noexcept;
+
+        /// Decriments the allocation count. This is checked when resetting to ensure that all previously
+        /// allocated memory has been deallocated.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate.
+        ///
+        void Deallocate(void* pointer) noexcept override;
+
+        /// Evaluates whether or not the given pointer was allocated from this linear
+        /// allocator.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param pointer
+        ///        The pointer.
+        ///
+        /// @return Whether or not the pointer was allocated from this allocator.
+        ///
+        bool Contains(void* pointer) const noexcept;
+
+        /// Resets the buffer, allowing all previously allocated memory to be reused. Deallocate() must
+        /// have been called for all allocated blocks prior to reset() being called.
+        ///
+        /// This is not thread-safe, and must not be called while other threads are allocating.
+        /// 
+        void Reset() noexcept;
+
+        ~ConcurrentLinearAllocator() noexcept;
+
+    private:
+        ConcurrentLinearAllocator(ConcurrentLinearAllocator&) = delete;
+        ConcurrentLinearAllocator& operator=(ConcurrentLinearAllocator&) = delete;
+        ConcurrentLinearAllocator(ConcurrentLinearAllocator&&) = delete;
+        ConcurrentLinearAllocator& operator=(ConcurrentLinearAllocator&&) = delete;
+
+        const std::size_t m_bufferSize;
+
+        IAllocator* m_parentAllocator = nullptr;
+        bool m_isBufferOwned = true;
+
+        std::uint8_t* m_buffer = nullptr;
+        std::atomic<std::size_t> m_nextOffset;
+        std::atomic<std::size_t> m_activeAllocationCount;
+    };
+}
+
+#endif
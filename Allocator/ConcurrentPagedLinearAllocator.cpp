@@ -0,0 +1,199 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "ConcurrentPagedLinearAllocator.h"
+
+#include "../Utility/MemoryUtils.h"
+
+#include <cassert>
+#include <new>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::Page::Page(void* buffer, std::size_t bufferSize) noexcept
+        : m_linearAllocator(buffer, bufferSize), m_next(nullptr)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::ConcurrentPagedLinearAllocator(std::size_t pageSize) noexcept
+        : m_pageSize(pageSize), m_pageHeaderSize(MemoryUtils::Align(sizeof(Page), sizeof(std::intptr_t))), m_currentPage(nullptr), m_numPages(1)
+    {
+        m_firstPage = CreatePage();
+        m_currentPage.store(m_firstPage, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::ConcurrentPagedLinearAllocator(IAllocator& parentAllocator, std::size_t pageSize) noexcept
+        : m_pageSize(pageSize), m_pageHeaderSize(MemoryUtils::Align(sizeof(Page), sizeof(std::intptr_t))), m_parentAllocator(&parentAllocator), 
+        m_currentPage(nullptr), m_numPages(1)
+    {
+        m_firstPage = CreatePage();
+        m_currentPage.store(m_firstPage, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    void* ConcurrentPagedLinearAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        return Allocate(allocationSize, sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    void* ConcurrentPagedLinearAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(ConcurrentLinearAllocator::CalcReservedSize(allocationSize, alignment) <= m_pageSize);
+
+        auto page = m_currentPage.load(std::memory_order_acquire);
+        while (true)
+        {
+            auto output = page->m_linearAllocator.TryAllocate(allocationSize, alignment);
+            if (output)
+            {
+                return output;
+            }
+
+            // If this fails then another thread has already moved on, so either way the 
+            // current page is at least as far as the next page.
+            auto nextPage = GetOrCreateNextPage(page);
+            m_currentPage.compare_exchange_strong(page, nextPage, std::memory_order_acq_rel, std::memory_order_acquire);
+            page = nextPage;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentPagedLinearAllocator::Deallocate(void* pointer) noexcept
+    {
+        auto page = m_firstPage;
+        while (page)
+        {
+            if (page->m_linearAllocator.Contains(pointer))
+            {
+                return page->m_linearAllocator.Deallocate(pointer);
+            }
+
+            page = page->m_next.load(std::memory_order_acquire);
+        }
+
+        assert(false);
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentPagedLinearAllocator::Reset() noexcept
+    {
+        auto page = m_firstPage;
+        while (page)
+        {
+            page->m_linearAllocator.Reset();
+            page = page->m_next.load(std::memory_order_relaxed);
+        }
+
+        m_currentPage.store(m_firstPage, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentPagedLinearAllocator::ResetAndShrink() noexcept
+    {
+        Reset();
+
+        auto page = m_firstPage->m_next.load(std::memory_order_relaxed);
+        while (page)
+        {
+            auto next = page->m_next.load(std::memory_order_relaxed);
+            DestroyPage(page);
+            page = next;
+        }
+
+        m_firstPage->m_next.store(nullptr, std::memory_order_relaxed);
+        m_numPages.store(1, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::Page* ConcurrentPagedLinearAllocator::CreatePage() noexcept
+    {
+        void* pageBuffer;
+        if (m_parentAllocator)
+        {
+            pageBuffer = m_parentAllocator->Allocate(m_pageHeaderSize + m_pageSize, sizeof(std::intptr_t));
+        }
+        else
+        {
+            pageBuffer = MemoryUtils::AllocateAligned(m_pageHeaderSize + m_pageSize, sizeof(std::intptr_t));
+        }
+
+        assert(pageBuffer);
+
+        return new (pageBuffer) Page(reinterpret_cast<std::uint8_t*>(pageBuffer) + m_pageHeaderSize, m_pageSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void ConcurrentPagedLinearAllocator::DestroyPage(Page* page) noexcept
+    {
+        page->~Page();
+
+        if (m_parentAllocator)
+        {
+            m_parentAllocator->Deallocate(page);
+        }
+        else
+        {
+            MemoryUtils::DeallocateAligned(page);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::Page* ConcurrentPagedLinearAllocator::GetOrCreateNextPage(Page* page) noexcept
+    {
+        auto nextPage = page->m_next.load(std::memory_order_acquire);
+        if (nextPage)
+        {
+            return nextPage;
+        }
+
+        auto newPage = CreatePage();
+        if (page->m_next.compare_exchange_strong(nextPage, newPage, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            m_numPages.fetch_add(1, std::memory_order_relaxed);
+            return newPage;
+        }
+
+        // Another thread installed a page first. The new page was never visible to any
+        // other thread, so can be destroyed immediately.
+        DestroyPage(newPage);
+        return nextPage;
+    }
+
+    //------------------------------------------------------------------------------
+    ConcurrentPagedLinearAllocator::~ConcurrentPagedLinearAllocator() noexcept
+    {
+        Reset();
+
+        auto page = m_firstPage;
+        while (page)
+        {
+            auto next = page->m_next.load(std::memory_order_relaxed);
+            DestroyPage(page);
+            page = next;
+        }
+    }
+}
@@ -0,0 +1,210 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef _ICMEMORY_ALLOCATOR_CONCURRENTPAGEDLINEARALLOCATOR_H_
+#define _ICMEMORY_ALLOCATOR_CONCURRENTPAGEDLINEARALLOCATOR_H_
+
+#include "ConcurrentLinearAllocator.h"
+
+#include <atomic>
+
+namespace IC
+{
+    /// A thread-safe version of the PagedLinearAllocator. Each page is a 
+    /// ConcurrentLinearAllocator, so allocation within a page is a single atomic fetch-add.
+    /// If an allocation will not fit in the current page then allocation moves on to the
+    /// next page. If there is no next page, a new page is allocated and installed with a
+    /// compare-and-swap; if another thread installed a page first then the new page is
+    /// released and the other thread's page is used instead.
+    ///
+    /// Once a page has been allocated it will not be deallocated until ResetAndShink() is 
+    /// called. Resetting is not thread-safe, and must not be done while other threads are
+    /// allocating.
+    ///
+    /// A ConcurrentPagedLinearAllocator can be backed by other allocator types, from which
+    /// pages will be allocated, otherwise they are allocated from the free store. Pages
+    /// can be allocated from multiple threads at the same time, so the parent allocator 
+    /// must be thread-safe.
+    ///
+    class ConcurrentPagedLinearAllocator final : public IAllocator
+    {
+    public:
+        static constexpr std::size_t k_defaultPageSize = 4 * 1024;
+
+        /// Initialises a new ConcurrentPagedLinearAllocator with the given page size. Pages will
+        /// be allocated from the free store.
+        ///
+        /// @param pageSize
+        ///     The size of a page.
+        /// 
+        ConcurrentPagedLinearAllocator(std::size_t pageSize = k_defaultPageSize) noexcept;
+
+        /// Initialises a new ConcurrentPagedLinearAllocator with the given page size. Pages will
+        /// be allocated from the given parent allocator, which must be thread-safe.
+        ///
+        /// @param parentAllocator
+        ///     The allocator from which pages will be allocated.
+        /// @param pageSize
+        ///     The size of a page.
+        /// 
+        ConcurrentPagedLinearAllocator(IAllocator& parentAllocator, std::size_t pageSize = k_defaultPageSize) noexcept;
+
+        /// This thread-safe.
+        ///
+        /// @return The maximum allocation size from this allocator. This will always be 
+        /// the size of a page.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override { return GetPageSize(); }
+
+        /// This thread-safe.
+        ///
+        /// @return The size of a page. 
+        ///
+        std::size_t GetPageSize() const noexcept { return m_pageSize; }
+
+        /// This is thread-safe, though the value may be out of date by the time it is
+        /// used.
+        ///
+        /// @return The number of pages in the allocator.
+        ///
+        std::size_t GetNumPages() const noexcept { return m_numPages.load(std::memory_order_relaxed); }
+
+        /// Allocates a new block of memory of the requested size. If there is no space left in the
+        /// current page for the alloaction then the next page will be used, allocating it if needed.
+        /// Allocations must be smaller than the size of a single page.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Allocates a new block of memory of the requested size and alignment. If there is no
+        /// space left in the current page for the alloaction then the next page will be used,
+        /// allocating it if needed. The aligned allocation must fit within a single page.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
+        /// Decriments the allocation count of the page which owns the pointer. This is 
+        /// checked when resetting to ensure that all previously allocated memory has been 
+        /// deallocated.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate.
+        ///
+        void Deallocate(void* pointer) noexcept override;
+
+        /// Resets the allocator, allowing all previously allocated memory to be reused. 
+        /// Deallocate() must have been called for all allocated blocks prior to reset() 
+        /// being called. This does not deallocate any pages.
+        ///
+        /// This is not thread-safe, and must not be called while other threads are allocating.
+        ///
+        void Reset() noexcept;
+
+        /// Resets the allocator, allowing all previously allocated memory to be reused. 
+        /// Deallocate() must have been called for all allocated blocks prior to reset()
+        /// being called. All pages other than the first are deallocated.
+        ///
+        /// This is not thread-safe, and must not be called while other threads are allocating.
+        ///
+        void ResetAndShrink() noexcept;
+
+        ~ConcurrentPagedLinearAllocator() noexcept;
+
+    private:
+        /// The header stored at the start of each page. The page's buffer follows the 
+        /// header.
+        ///
+        struct Page final
+        {
+            /// Creates a new page header, with the linear allocator using the given
+            /// buffer.
+            ///
+            /// @param buffer
+            ///     The buffer from which memory will be allocated.
+            /// @param bufferSize
+            ///     The size of the buffer.
+            ///
+            Page(void* buffer, std::size_t bufferSize) noexcept;
+
+            ConcurrentLinearAllocator m_linearAllocator;
+            std::atomic<Page*> m_next;
+        };
+
+        ConcurrentPagedLinearAllocator(ConcurrentPagedLinearAllocator&) = delete;
+        ConcurrentPagedLinearAllocator& operator=(ConcurrentPagedLinearAllocator&) = delete;
+        ConcurrentPagedLinearAllocator(ConcurrentPagedLinearAllocator&&) = delete;
+        ConcurrentPagedLinearAllocator& operator=(ConcurrentPagedLinearAllocator&&) = delete;
+
+        /// Allocates a new page, either from the parent allocator or the free store. This
+        /// does not add the page to the page list.
+        ///
+        /// @return The new page.
+        ///
+        Page* CreatePage() noexcept;
+
+        /// Destroys the given page, returning its memory either to the parent allocator
+        /// or the free store. This does not remove the page from the page list.
+        ///
+        /// @param page
+        ///     The page which should be destroyed.
+        ///
+        void DestroyPage(Page* page) noexcept;
+
+        /// Gets the page after the given page, creating it and installing it with a 
+        /// compare-and-swap if there isn't one.
+        ///
+        /// @param page
+        ///     The page.
+        ///
+        /// @return The next page.
+        ///
+        Page* GetOrCreateNextPage(Page* page) noexcept;
+
+        const std::size_t m_pageSize;
+        const std::size_t m_pageHeaderSize;
+
+        IAllocator* m_parentAllocator = nullptr;
+
+        Page* m_firstPage = nullptr;
+        std::atomic<Page*> m_currentPage;
+        std::atomic<std::size_t> m_numPages;
+    };
+}
+
+#endif
@@ -0,0 +1,208 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "DoubleEndedStackAllocator.h"
+
+#include "../Utility/MemoryUtils.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    DoubleEndedStackAllocator::DoubleEndedStackAllocator(std::size_t bufferSize) noexcept
+        : m_bufferSize(MemoryUtils::Align(bufferSize, sizeof(std::intptr_t)))
+    {
+        assert(m_bufferSize > sizeof(Header));
+
+        m_buffer = reinterpret_cast<std::uint8_t*>(MemoryUtils::AllocateAligned(m_bufferSize, sizeof(std::intptr_t)));
+        m_frontTop = m_buffer;
+        m_backTop = m_buffer + m_bufferSize;
+    }
+
+    //------------------------------------------------------------------------------
+    DoubleEndedStackAllocator::DoubleEndedStackAllocator(IAllocator& parentAllocator, std::size_t bufferSize) noexcept
+        : m_bufferSize(MemoryUtils::Align(bufferSize, sizeof(std::intptr_t))), m_parentAllocator(&parentAllocator)
+    {
+        assert(m_bufferSize > sizeof(Header));
+
+        m_buffer = reinterpret_cast<std::uint8_t*>(m_parentAllocator->Allocate(m_bufferSize, sizeof(std::intptr_t)));
+        m_frontTop = m_buffer;
+        m_backTop = m_buffer + m_bufferSize;
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t DoubleEndedStackAllocator::GetMaxAllocationSize() const noexcept
+    {
+        return m_bufferSize - sizeof(Header);
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t DoubleEndedStackAllocator::GetFreeSpace() const noexcept
+    {
+        return MemoryUtils::GetPointerOffset(m_backTop, m_frontTop);
+    }
+
+    //------------------------------------------------------------------------------
+    void* DoubleEndedStackAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        return Allocate(allocationSize, sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    void* DoubleEndedStackAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        alignment = std::max(alignment, sizeof(std::intptr_t));
+
+        // A zero size allocation still takes a byte, so that it can't be placed on the end
+        // of the buffer when the front stack fills it.
+        allocationSize = std::max(allocationSize, std::size_t(1));
+
+        auto output = MemoryUtils::Align(m_frontTop + sizeof(Header), alignment);
+        assert(output <= m_backTop);
+        assert(allocationSize <= MemoryUtils::GetPointerOffset(m_backTop, output));
+
+        auto header = GetHeader(output);
+        header->m_previousTop = m_frontTop;
+        header->m_previousAllocation = m_frontLastAllocation;
+
+        m_frontTop = std::min(MemoryUtils::Align(output + allocationSize, sizeof(std::intptr_t)), m_backTop);
+        m_frontLastAllocation = output;
+
+        return output;
+    }
+
+    //------------------------------------------------------------------------------
+    void* DoubleEndedStackAllocator::AllocateBack(std::size_t allocationSize) noexcept
+    {
+        return AllocateBack(allocationSize, sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    void* DoubleEndedStackAllocator::AllocateBack(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        alignment = std::max(alignment, sizeof(std::intptr_t));
+
+        // On an empty back stack a zero size allocation would be placed on the end of the
+        // buffer, which Contains() rejects, so it still takes a byte.
+        allocationSize = std::max(allocationSize, std::size_t(1));
+
+        // The back stack grows down, so the allocation is placed at the highest aligned
+        // address it fits below the current top, with its header immediately before it.
+        assert(allocationSize + sizeof(Header) <= GetFreeSpace());
+        auto outputInt = (reinterpret_cast<std::uintptr_t>(m_backTop) - allocationSize) & ~(alignment - 1);
+        auto output = reinterpret_cast<std::uint8_t*>(outputInt);
+        assert(output >= m_frontTop + sizeof(Header));
+
+        auto header = GetHeader(output);
+        header->m_previousTop = m_backTop;
+        header->m_previousAllocation = m_backLastAllocation;
+
+        m_backTop = reinterpret_cast<std::uint8_t*>(header);
+        m_backLastAllocation = output;
+
+        return output;
+    }
+
+    //------------------------------------------------------------------------------
+    void DoubleEndedStackAllocator::Deallocate(void* pointer) noexcept
+    {
+        assert(Contains(pointer));
+
+        // Every allocation in the back stack is above every allocation in the front stack.
+        auto header = GetHeader(pointer);
+        if (m_frontLastAllocation && pointer <= m_frontLastAllocation)
+        {
+            assert(pointer == m_frontLastAllocation);
+
+            m_frontTop = header->m_previousTop;
+            m_frontLastAllocation = header->m_previousAllocation;
+        }
+        else
+        {
+            assert(pointer == m_backLastAllocation);
+
+            m_backTop = header->m_previousTop;
+            m_backLastAllocation = header->m_previousAllocation;
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    bool DoubleEndedStackAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        assert(Contains(pointer));
+
+        if (pointer == m_frontLastAllocation)
+        {
+            if (newSize > MemoryUtils::GetPointerOffset(m_backTop, m_frontLastAllocation))
+            {
+                return false;
+            }
+
+            m_frontTop = std::min(MemoryUtils::Align(m_frontLastAllocation + newSize, sizeof(std::intptr_t)), m_backTop);
+            return true;
+        }
+
+        if (pointer == m_backLastAllocation)
+        {
+            return newSize <= MemoryUtils::GetPointerOffset(GetHeader(pointer)->m_previousTop, m_backLastAllocation);
+        }
+
+        return false;
+    }
+
+    //------------------------------------------------------------------------------
+    bool DoubleEndedStackAllocator::Contains(void* pointer) const noexcept
+    {
+        return (pointer >= m_buffer && pointer < m_buffer + m_bufferSize);
+    }
+
+    //------------------------------------------------------------------------------
+    DoubleEndedStackAllocator::Header* DoubleEndedStackAllocator::GetHeader(void* pointer) noexcept
+    {
+        return reinterpret_cast<Header*>(reinterpret_cast<std::uint8_t*>(pointer) - sizeof(Header));
+    }
+
+    //------------------------------------------------------------------------------
+    DoubleEndedStackAllocator::~DoubleEndedStackAllocator() noexcept
+    {
+        assert(m_frontLastAllocation == nullptr);
+        assert(m_backLastAllocation == nullptr);
+
+        if (m_parentAllocator)
+        {
+            m_parentAllocator->Deallocate(m_buffer);
+        }
+        else
+        {
+            MemoryUtils::DeallocateAligned(m_buffer);
+        }
+
+        m_buffer = nullptr;
+    }
+}
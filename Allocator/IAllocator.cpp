@@ -0,0 +1,54 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include "IAllocator.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    void* IAllocator::Reallocate(void* pointer, std::size_t currentSize, std::size_t newSize) noexcept
+    {
+        if (!pointer)
+        {
+            return Allocate(newSize);
+        }
+
+        if (TryResizeInPlace(pointer, newSize))
+        {
+            return pointer;
+        }
+
+        void* newPointer = Allocate(newSize);
+        if (!newPointer)
+        {
+            return nullptr;
+        }
+
+        std::memcpy(newPointer, pointer, std::min(currentSize, newSize));
+        Deallocate(pointer, currentSize);
+
+        return newPointer;
+    }
+}
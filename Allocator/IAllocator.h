@@ -57,6 +57,19 @@ namespace IC
         ///
         virtual void* Allocate(std::size_t allocationSize) noexcept = 0;
 
+        /// Allocates a new block of memory of the requested size, aligned to the given
+        /// alignment. Note that the underlying implementation may allocate more memory 
+        /// than has been requested, and may limit the supported alignments.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        virtual void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept = 0;
+
         /// Deallocates the given memory. This must have been allocated via this allocator.
         /// Note that the underlying implementation may not actually deallocate the memory
         /// at this point, though deallocate must still be called.
@@ -66,6 +79,52 @@ namespace IC
         ///
         virtual void Deallocate(void* pointer) noexcept = 0;
 
+        /// Deallocates the given memory, using the size of the allocation to avoid
+        /// looking up which block or page the memory belongs to where possible. By default 
+        /// the size is ignored.
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate. This must have been allocated via this allocator.
+        /// @param allocationSize
+        ///     The size of the allocation, as passed to Allocate() or to the last successful
+        ///     resize. If the allocation was aligned to more than its size, this should be
+        ///     the alignment instead.
+        ///
+        virtual void Deallocate(void* pointer, std::size_t /*allocationSize*/) noexcept { Deallocate(pointer); }
+
+        /// Attempts to grow or shrink the given allocation without moving it. Note that the
+        /// underlying implementation may not support this, in which case it will always
+        /// fail. If this fails, the allocation is unchanged.
+        ///
+        /// @param pointer
+        ///     The allocation which should be resized. This must have been allocated via
+        ///     this allocator.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return Whether or not the allocation was resized.
+        ///
+        virtual bool TryResizeInPlace(void* /*pointer*/, std::size_t /*newSize*/) noexcept { return false; }
+
+        /// Resizes the given allocation. The allocation is first resized in place if possible,
+        /// otherwise a new allocation is made, the contents are copied across and the old
+        /// allocation is deallocated.
+        ///
+        /// @param pointer
+        ///     The allocation which should be resized. This must have been allocated via
+        ///     this allocator. If null, this is equivalent to Allocate().
+        /// @param currentSize
+        ///     The size of the existing allocation, which is used to determine how much
+        ///     needs to be copied if the allocation is moved.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return The resized allocation. This may or may not be the same as the given
+        /// pointer. If the new allocation fails then null is returned and the existing
+        /// allocation is left unchanged.
+        ///
+        void* Reallocate(void* pointer, std::size_t currentSize, std::size_t newSize) noexcept;
+
         virtual ~IAllocator() noexcept { }
     };
 }
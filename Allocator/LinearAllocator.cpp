@@ -49,7 +49,21 @@ namespace IC
     //------------------------------------------------------------------------------
     std::size_t LinearAllocator::GetFreeSpace() const noexcept
     {
-        auto freeSpace = m_bufferSize - MemoryUtils::GetPointerOffset(m_nextPointer, m_buffer);
+        return GetFreeSpace(sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t LinearAllocator::GetFreeSpace(std::size_t alignment) const noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        auto alignedOffset = MemoryUtils::GetPointerOffset(MemoryUtils::Align(m_nextPointer, alignment), m_buffer);
+        if (alignedOffset >= m_bufferSize)
+        {
+            return 0;
+        }
+
+        auto freeSpace = m_bufferSize - alignedOffset;
         auto freeSpaceAligned = freeSpace & ~(sizeof(std::intptr_t) - 1);
         return freeSpaceAligned;
     }
@@ -57,10 +71,17 @@ namespace IC
     //------------------------------------------------------------------------------
     void* LinearAllocator::Allocate(std::size_t allocationSize) noexcept
     {
-        assert(allocationSize <= GetFreeSpace());
+        return Allocate(allocationSize, sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    void* LinearAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(allocationSize <= GetFreeSpace(alignment));
 
-        std::uint8_t* output = m_nextPointer;
+        std::uint8_t* output = MemoryUtils::Align(m_nextPointer, alignment);
         m_nextPointer = MemoryUtils::Align(m_nextPointer + allocationSize, sizeof(std::intptr_t));
+        m_lastAllocation = output;
 
         ++m_activeAllocationCount;
 
@@ -75,6 +96,20 @@ namespace IC
         --m_activeAllocationCount;
     }
 
+    //------------------------------------------------------------------------------
+    bool LinearAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        assert(Contains(pointer));
+
+        if (pointer != m_lastAllocation || newSize > m_bufferSize - MemoryUtils::GetPointerOffset(m_lastAllocation, m_buffer))
+        {
+            return false;
+        }
+
+        m_nextPointer = MemoryUtils::Align(m_lastAllocation + newSize, sizeof(std::intptr_t));
+        return true;
+    }
+
     //------------------------------------------------------------------------------
     bool LinearAllocator::Contains(void* pointer) noexcept
     {
@@ -87,6 +122,28 @@ namespace IC
         assert(m_activeAllocationCount == 0);
 
         m_nextPointer = MemoryUtils::Align(m_buffer, sizeof(std::intptr_t));
+        m_lastAllocation = nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    LinearAllocator::Marker LinearAllocator::GetMarker() const noexcept
+    {
+        Marker marker;
+        marker.m_nextPointer = m_nextPointer;
+        marker.m_lastAllocation = m_lastAllocation;
+        marker.m_activeAllocationCount = m_activeAllocationCount;
+
+        return marker;
+    }
+
+    //------------------------------------------------------------------------------
+    void LinearAllocator::RewindTo(const Marker& marker) noexcept
+    {
+        assert(marker.m_nextPointer >= m_buffer && marker.m_nextPointer <= m_nextPointer);
+        assert(m_activeAllocationCount <= marker.m_activeAllocationCount);
+
+        m_nextPointer = marker.m_nextPointer;
+        m_lastAllocation = marker.m_lastAllocation;
     }
 
     //------------------------------------------------------------------------------
@@ -39,12 +39,26 @@ namespace IC
     /// A LinearAllocator can be backed by other allocator types, from which the buffer
     /// will be allocated, otherwise it's allocated from the free store.
     ///
+    /// As well as resetting the whole buffer, a marker can be taken and the allocator
+    /// later rewound to it, which frees everything allocated since. Markers can be
+    /// nested, and ScopedLinearAllocation rewinds to a marker automatically.
+    ///
     /// Note that this is not thread-safe and should not be accessed from multiple
     /// threads at the same time.
     ///
     class LinearAllocator final : public IAllocator
     {
     public:
+        /// A position in the allocator which it can later be rewound to. This should be
+        /// treated as opaque.
+        ///
+        struct Marker final
+        {
+            std::uint8_t* m_nextPointer = nullptr;
+            std::uint8_t* m_lastAllocation = nullptr;
+            std::size_t m_activeAllocationCount = 0;
+        };
+
         /// Initialises a new Linear Allocator with the given buffer size. The buffer will be allocated
         /// from the free store.
         ///
@@ -80,6 +94,14 @@ namespace IC
         ///
         std::size_t GetFreeSpace() const noexcept;
 
+        /// @param alignment
+        ///     The alignment of the next allocation. Must be a power of two.
+        ///
+        /// @return The number of bytes which are free in the buffer after aligning the
+        /// next allocation to the given alignment.
+        ///
+        std::size_t GetFreeSpace(std::size_t alignment) const noexcept;
+
         /// Allocates a new block of memory of the requested size. If there is no space left in the
         /// buffer for the alloaction then this will assert.
         ///
@@ -90,6 +112,19 @@ namespace IC
         ///
         void* Allocate(std::size_t allocationSize) noexcept override;
 
+        /// Allocates a new block of memory of the requested size and alignment. The next 
+        /// allocation pointer is simply moved forward to the required alignment. If there 
+        /// is no space left in the buffer for the alloaction then this will assert.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
         /// Decriments the allocation count. This is checked when resetting to ensure that all previously
         /// allocated memory has been deallocated.
         ///
@@ -98,6 +133,19 @@ namespace IC
         ///
         void Deallocate(void* pointer) noexcept override;
 
+        /// Attempts to resize the given allocation without moving it. This is only possible
+        /// for the most recent allocation, which can grow into the remaining free space in
+        /// the buffer, or shrink.
+        ///
+        /// @param pointer
+        ///     The allocation which should be resized.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return Whether or not the allocation was resized.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
         /// Evaluates whether or not the given pointer was allocated from this linear
         /// allocator.
         ///
@@ -113,6 +161,20 @@ namespace IC
         /// 
         void Reset() noexcept;
 
+        /// @return A marker for the current position in the buffer.
+        ///
+        Marker GetMarker() const noexcept;
+
+        /// Rewinds the buffer to the given marker, allowing all memory allocated since the
+        /// marker was taken to be reused. Deallocate() must have been called for all blocks
+        /// allocated since the marker was taken. The allocator must not have been reset or
+        /// rewound to an earlier marker since the marker was taken.
+        ///
+        /// @param marker
+        ///     The marker to rewind to.
+        ///
+        void RewindTo(const Marker& marker) noexcept;
+
         ~LinearAllocator() noexcept;
 
     private:
@@ -123,10 +185,11 @@ namespace IC
 
         const std::size_t m_bufferSize;
 
-        IAllocator* m_parentAllocator;
+        IAllocator* m_parentAllocator = nullptr;
 
         std::uint8_t* m_buffer;
         std::uint8_t* m_nextPointer = nullptr;
+        std::uint8_t* m_lastAllocation = nullptr;
 
         std::size_t m_activeAllocationCount = 0;
     };
@@ -0,0 +1,154 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "MultiBufferedAllocator.h"
+
+#include "../Utility/MemoryUtils.h"
+
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    MultiBufferedAllocator::MultiBufferedAllocator(std::size_t bufferSize, std::size_t numBuffers) noexcept
+        : m_bufferSize(MemoryUtils::Align(bufferSize, k_bufferAlignment)), m_numBuffers(numBuffers)
+    {
+        assert(m_numBuffers >= 2);
+
+        m_buffers = reinterpret_cast<std::uint8_t*>(MemoryUtils::AllocateAligned(m_bufferSize * m_numBuffers, k_bufferAlignment));
+        m_nextPointer = GetBuffer(m_currentBufferIndex);
+    }
+
+    //------------------------------------------------------------------------------
+    MultiBufferedAllocator::MultiBufferedAllocator(IAllocator& parentAllocator, std::size_t bufferSize, std::size_t numBuffers) noexcept
+        : m_bufferSize(MemoryUtils::Align(bufferSize, k_bufferAlignment)), m_numBuffers(numBuffers), m_parentAllocator(&parentAllocator)
+    {
+        assert(m_numBuffers >= 2);
+
+        m_buffers = reinterpret_cast<std::uint8_t*>(m_parentAllocator->Allocate(m_bufferSize * m_numBuffers, k_bufferAlignment));
+        m_nextPointer = GetBuffer(m_currentBufferIndex);
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t MultiBufferedAllocator::GetFreeSpace() const noexcept
+    {
+        return GetFreeSpace(sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t MultiBufferedAllocator::GetFreeSpace(std::size_t alignment) const noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        auto alignedOffset = MemoryUtils::GetPointerOffset(MemoryUtils::Align(m_nextPointer, alignment), GetBuffer(m_currentBufferIndex));
+        if (alignedOffset >= m_bufferSize)
+        {
+            return 0;
+        }
+
+        return m_bufferSize - alignedOffset;
+    }
+
+    //------------------------------------------------------------------------------
+    void* MultiBufferedAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        return Allocate(allocationSize, sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    void* MultiBufferedAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(allocationSize <= GetFreeSpace(alignment));
+
+        std::uint8_t* output = MemoryUtils::Align(m_nextPointer, alignment);
+        m_nextPointer = MemoryUtils::Align(output + allocationSize, sizeof(std::intptr_t));
+        m_lastAllocation = output;
+
+        return output;
+    }
+
+    //------------------------------------------------------------------------------
+    void MultiBufferedAllocator::Deallocate(void* pointer) noexcept
+    {
+        assert(Contains(pointer));
+    }
+
+    //------------------------------------------------------------------------------
+    bool MultiBufferedAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        assert(Contains(pointer));
+
+        if (pointer != m_lastAllocation || newSize > m_bufferSize - MemoryUtils::GetPointerOffset(m_lastAllocation, GetBuffer(m_currentBufferIndex)))
+        {
+            return false;
+        }
+
+        m_nextPointer = MemoryUtils::Align(m_lastAllocation + newSize, sizeof(std::intptr_t));
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+    bool MultiBufferedAllocator::Contains(void* pointer) const noexcept
+    {
+        return (pointer >= m_buffers && pointer < m_buffers + m_bufferSize * m_numBuffers);
+    }
+
+    //------------------------------------------------------------------------------
+    void MultiBufferedAllocator::Swap() noexcept
+    {
+        m_currentBufferIndex = (m_currentBufferIndex + 1) % m_numBuffers;
+        m_nextPointer = GetBuffer(m_currentBufferIndex);
+        m_lastAllocation = nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    void MultiBufferedAllocator::Reset() noexcept
+    {
+        m_currentBufferIndex = 0;
+        m_nextPointer = GetBuffer(m_currentBufferIndex);
+        m_lastAllocation = nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    std::uint8_t* MultiBufferedAllocator::GetBuffer(std::size_t index) const noexcept
+    {
+        assert(index < m_numBuffers);
+
+        return m_buffers + index * m_bufferSize;
+    }
+
+    //------------------------------------------------------------------------------
+    MultiBufferedAllocator::~MultiBufferedAllocator() noexcept
+    {
+        if (m_parentAllocator)
+        {
+            m_parentAllocator->Deallocate(m_buffers);
+        }
+        else
+        {
+            MemoryUtils::DeallocateAligned(m_buffers);
+        }
+
+        m_buffers = nullptr;
+    }
+}
@@ -0,0 +1,212 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef _ICMEMORY_ALLOCATOR_MULTIBUFFEREDALLOCATOR_H_
+#define _ICMEMORY_ALLOCATOR_MULTIBUFFEREDALLOCATOR_H_
+
+#include "IAllocator.h"
+
+namespace IC
+{
+    /// A linear allocator which allocates from a ring of buffers, for data which must
+    /// outlive the frame it was allocated in. Allocations are taken from the current
+    /// buffer by simply moving the next allocation pointer through it. Calling Swap()
+    /// moves on to the next buffer in the ring, 'deallocating' everything in it, so 
+    /// memory allocated in one frame remains valid for the following numBuffers - 1 
+    /// calls to Swap(). With the default of two buffers this is a double-buffered 
+    /// allocator: data allocated in one frame can be read by a consumer during the 
+    /// next.
+    ///
+    /// Unlike LinearAllocator no allocation count is kept, so Deallocate() does nothing
+    /// and does not need to be called. Objects allocated from this must either have
+    /// trivial destructors or be destroyed before the buffer is reused.
+    ///
+    /// A MultiBufferedAllocator can be backed by other allocator types, from which the 
+    /// buffers will be allocated, otherwise they are allocated from the free store.
+    ///
+    /// Each buffer starts on a k_bufferAlignment boundary, and the buffer size is rounded
+    /// up to a multiple of it, so an allocation of up to the full buffer size can be made
+    /// with any alignment up to k_bufferAlignment. Larger alignments reduce the maximum
+    /// size by up to the alignment minus k_bufferAlignment.
+    ///
+    /// Note that this is not thread-safe and should not be accessed from multiple
+    /// threads at the same time. Memory which was allocated by one thread can be read
+    /// by another, as long as Swap() is synchronised with the reader.
+    ///
+    class MultiBufferedAllocator final : public IAllocator
+    {
+    public:
+        static constexpr std::size_t k_defaultNumBuffers = 2;
+        static constexpr std::size_t k_bufferAlignment = 64;
+
+        /// Initialises a new MultiBufferedAllocator with the given buffer size. The buffers
+        /// will be allocated from the free store.
+        ///
+        /// @param bufferSize
+        ///     The size of each buffer. This is rounded up to a multiple of k_bufferAlignment.
+        /// @param numBuffers
+        ///     Optional. The number of buffers in the ring. Must be at least two. Defaults
+        ///     to k_defaultNumBuffers.
+        /// 
+        MultiBufferedAllocator(std::size_t bufferSize, std::size_t numBuffers = k_defaultNumBuffers) noexcept;
+
+        /// Initialises a new MultiBufferedAllocator with the given buffer size. The buffers
+        /// will be allocated from the given parent allocator.
+        ///
+        /// @param parentAllocator
+        ///     The allocator from which the buffers will be allocated.
+        /// @param bufferSize
+        ///     The size of each buffer. This is rounded up to a multiple of k_bufferAlignment.
+        /// @param numBuffers
+        ///     Optional. The number of buffers in the ring. Must be at least two. Defaults
+        ///     to k_defaultNumBuffers.
+        /// 
+        MultiBufferedAllocator(IAllocator& parentAllocator, std::size_t bufferSize, std::size_t numBuffers = k_defaultNumBuffers) noexcept;
+
+        /// This thread-safe.
+        ///
+        /// @return The maximum allocation size from this allocator. This will always be 
+        /// the size of a buffer.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override { return GetBufferSize(); }
+
+        /// This thread-safe.
+        ///
+        /// @return The size of each buffer. 
+        ///
+        std::size_t GetBufferSize() const noexcept { return m_bufferSize; }
+
+        /// This thread-safe.
+        ///
+        /// @return The number of buffers in the ring. 
+        ///
+        std::size_t GetNumBuffers() const noexcept { return m_numBuffers; }
+
+        /// @return The index of the buffer which allocations are currently taken from.
+        ///
+        std::size_t GetCurrentBufferIndex() const noexcept { return m_currentBufferIndex; }
+
+        /// @return The number of bytes which are free in the current buffer. 
+        ///
+        std::size_t GetFreeSpace() const noexcept;
+
+        /// @param alignment
+        ///     The alignment of the next allocation. Must be a power of two.
+        ///
+        /// @return The number of bytes which are free in the current buffer after aligning
+        /// the next allocation to the given alignment.
+        ///
+        std::size_t GetFreeSpace(std::size_t alignment) const noexcept;
+
+        /// Allocates a new block of memory of the requested size from the current buffer. If
+        /// there is no space left in the buffer for the alloaction then this will assert.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Allocates a new block of memory of the requested size and alignment from the
+        /// current buffer. The next allocation pointer is simply moved forward to the required
+        /// alignment. If there is no space left in the buffer for the alloaction then this will
+        /// assert.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
+        /// Does nothing, as memory is only freed when its buffer is reused by Swap().
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate.
+        ///
+        void Deallocate(void* pointer) noexcept override;
+
+        /// Attempts to resize the given allocation without moving it. This is only possible
+        /// for the most recent allocation in the current buffer, which can grow into the
+        /// remaining free space in the buffer, or shrink.
+        ///
+        /// @param pointer
+        ///     The allocation which should be resized.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return Whether or not the allocation was resized.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
+        /// Evaluates whether or not the given pointer was allocated from any of the 
+        /// buffers in this allocator.
+        ///
+        /// @param pointer
+        ///        The pointer.
+        ///
+        /// @return Whether or not the pointer was allocated from this allocator.
+        ///
+        bool Contains(void* pointer) const noexcept;
+
+        /// Moves on to the next buffer in the ring and resets it. Everything allocated from
+        /// that buffer, numBuffers calls to Swap() ago, is freed.
+        ///
+        void Swap() noexcept;
+
+        /// Resets all buffers and moves back to the first, freeing everything which has
+        /// been allocated.
+        ///
+        void Reset() noexcept;
+
+        ~MultiBufferedAllocator() noexcept;
+
+    private:
+        MultiBufferedAllocator(MultiBufferedAllocator&) = delete;
+        MultiBufferedAllocator& operator=(MultiBufferedAllocator&) = delete;
+        MultiBufferedAllocator(MultiBufferedAllocator&&) = delete;
+        MultiBufferedAllocator& operator=(MultiBufferedAllocator&&) = delete;
+
+        /// @param index
+        ///     The index of the buffer.
+        ///
+        /// @return The start of the buffer with the given index.
+        ///
+        std::uint8_t* GetBuffer(std::size_t index) const noexcept;
+
+        const std::size_t m_bufferSize;
+        const std::size_t m_numBuffers;
+
+        IAllocator* m_parentAllocator = nullptr;
+
+        std::uint8_t* m_buffers = nullptr;
+        std::size_t m_currentBufferIndex = 0;
+        std::uint8_t* m_nextPointer = nullptr;
+        std::uint8_t* m_lastAllocation = nullptr;
+    };
+}
+
+#endif
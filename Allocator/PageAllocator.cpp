@@ -0,0 +1,140 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "PageAllocator.h"
+
+#include "../Utility/MemoryUtils.h"
+#include "../Utility/VirtualMemoryUtils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <new>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    PageAllocator::PageAllocator(HugePageMode hugePageMode) noexcept
+        : m_hugePageMode(hugePageMode), 
+        m_pageSize(hugePageMode == HugePageMode::k_none ? VirtualMemoryUtils::GetPageSize() : VirtualMemoryUtils::GetHugePageSize()),
+        m_allocationCount(0)
+    {
+        assert(MemoryUtils::IsPowerOfTwo(m_pageSize));
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t PageAllocator::GetMaxAllocationSize() const noexcept
+    {
+        return std::numeric_limits<std::size_t>::max() - 2 * m_pageSize;
+    }
+
+    //------------------------------------------------------------------------------
+    void* PageAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        return Allocate(allocationSize, m_pageSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void* PageAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        alignment = std::max(alignment, m_pageSize);
+        auto committedSize = MemoryUtils::Align(std::max(allocationSize, std::size_t(1)), m_pageSize);
+
+        Mapping mapping;
+        std::uint8_t* output = nullptr;
+
+        if (m_hugePageMode == HugePageMode::k_explicit && alignment == m_pageSize)
+        {
+            // Huge pages are committed whole, so the mapping header takes the end of an
+            // extra huge page before the allocation.
+            mapping.m_reservedSize = committedSize + m_pageSize;
+            mapping.m_reservedPointer = VirtualMemoryUtils::ReserveHugePages(mapping.m_reservedSize);
+            if (mapping.m_reservedPointer)
+            {
+                output = reinterpret_cast<std::uint8_t*>(mapping.m_reservedPointer) + m_pageSize;
+            }
+        }
+
+        if (!output)
+        {
+            // The reserved range is only aligned to the operating system page size, so 
+            // enough extra is reserved to align it, leaving at least one page before the
+            // allocation for the mapping header. Only that page and the allocation are
+            // committed.
+            auto systemPageSize = VirtualMemoryUtils::GetPageSize();
+            mapping.m_reservedSize = committedSize + alignment;
+            mapping.m_reservedPointer = VirtualMemoryUtils::Reserve(mapping.m_reservedSize);
+            assert(mapping.m_reservedPointer);
+
+            output = MemoryUtils::Align(reinterpret_cast<std::uint8_t*>(mapping.m_reservedPointer) + systemPageSize, alignment);
+            auto committed = VirtualMemoryUtils::Commit(output - systemPageSize, committedSize + systemPageSize);
+            assert(committed);
+            (void)committed;
+
+            if (m_hugePageMode != HugePageMode::k_none)
+            {
+                VirtualMemoryUtils::AdviseHugePages(output, committedSize);
+            }
+        }
+
+        mapping.m_committedSize = committedSize;
+        new (GetMapping(output)) Mapping(mapping);
+        ++m_allocationCount;
+
+        return output;
+    }
+
+    //------------------------------------------------------------------------------
+    void PageAllocator::Deallocate(void* pointer) noexcept
+    {
+        assert(pointer);
+
+        auto mapping = *GetMapping(pointer);
+        assert(mapping.m_reservedPointer < pointer);
+        --m_allocationCount;
+
+        VirtualMemoryUtils::Release(mapping.m_reservedPointer, mapping.m_reservedSize);
+    }
+
+    //------------------------------------------------------------------------------
+    bool PageAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        assert(pointer);
+
+        return newSize <= GetMapping(pointer)->m_committedSize;
+    }
+
+    //------------------------------------------------------------------------------
+    PageAllocator::Mapping* PageAllocator::GetMapping(void* pointer) noexcept
+    {
+        return reinterpret_cast<Mapping*>(pointer) - 1;
+    }
+
+    //------------------------------------------------------------------------------
+    PageAllocator::~PageAllocator() noexcept
+    {
+        assert(m_allocationCount == 0);
+    }
+}
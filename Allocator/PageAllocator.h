@@ -0,0 +1,180 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef _ICMEMORY_ALLOCATOR_PAGEALLOCATOR_H_
+#define _ICMEMORY_ALLOCATOR_PAGEALLOCATOR_H_
+
+#include "IAllocator.h"
+
+#include <atomic>
+
+namespace IC
+{
+    /// An allocator which takes every allocation directly from the operating system as
+    /// whole pages, mapping new memory on allocation and unmapping it on deallocation.
+    /// This is intended to be used as the parent allocator for the other allocator
+    /// types, providing them with page aligned buffers which are only backed by physical
+    /// memory as they are touched, and which can optionally use huge pages to reduce TLB
+    /// misses for very large buffers.
+    ///
+    /// Every allocation is rounded up to a multiple of the page size, so this is not
+    /// suitable for small allocations. Alignments larger than a page are supported by
+    /// reserving extra address space, which is never committed.
+    ///
+    /// The size of each mapping is recorded in a small header immediately before the
+    /// allocation, so that it is known when the allocation is deallocated. This costs an
+    /// extra committed page per allocation, which is a huge page for k_explicit. No
+    /// other state is shared between allocations, so the allocator is thread-safe
+    /// without locking.
+    ///
+    class PageAllocator final : public IAllocator
+    {
+    public:
+        /// Describes whether or not allocations are backed by huge pages.
+        ///
+        /// k_none:         Allocations use normal pages.
+        /// k_transparent:  Allocations are aligned to, and a multiple of, the huge page
+        ///                 size, and the operating system is advised to back them with
+        ///                 transparent huge pages. Whether it does so is up to the
+        ///                 operating system.
+        /// k_explicit:     Allocations are taken from the explicitly reserved huge page
+        ///                 pool, such as MAP_HUGETLB on Linux. If no huge pages are
+        ///                 available then this falls back to k_transparent.
+        ///
+        enum class HugePageMode
+        {
+            k_none,
+            k_transparent,
+            k_explicit
+        };
+
+        /// Constructs a new page allocator.
+        ///
+        /// @param hugePageMode
+        ///     Whether or not allocations are backed by huge pages. Defaults to k_none.
+        ///
+        PageAllocator(HugePageMode hugePageMode = HugePageMode::k_none) noexcept;
+
+        /// This thread-safe.
+        ///
+        /// @return The maximum allocation size from this allocator. This is only limited
+        /// by the address space and memory available.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override;
+
+        /// This thread-safe.
+        ///
+        /// @return Whether or not allocations are backed by huge pages.
+        ///
+        HugePageMode GetHugePageMode() const noexcept { return m_hugePageMode; }
+
+        /// This thread-safe.
+        ///
+        /// @return The size of each page. All allocations are a multiple of this, and
+        /// aligned to at least this. This is the huge page size if huge pages are used.
+        ///
+        std::size_t GetPageSize() const noexcept { return m_pageSize; }
+
+        /// Allocates a new range of pages from the operating system, large enough for the
+        /// requested size, and aligned to the page size.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Allocates a new range of pages from the operating system, large enough for the
+        /// requested size, and aligned to the requested alignment or the page size, 
+        /// whichever is larger.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
+        /// Returns the pages to the operating system.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate.
+        ///
+        void Deallocate(void* pointer) noexcept override;
+
+        /// Resizing in place succeeds if the new size still fits in the pages which were
+        /// allocated.
+        ///
+        /// This is thread-safe.
+        ///
+        /// @param pointer
+        ///     The allocation which should be resized.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return Whether or not the allocation was resized.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
+        ~PageAllocator() noexcept;
+
+    private:
+        /// Describes the memory mapped for a single allocation. This is stored immediately
+        /// before the allocation.
+        ///
+        struct Mapping final
+        {
+            void* m_reservedPointer;
+            std::size_t m_reservedSize;
+            std::size_t m_committedSize;
+        };
+
+        /// @param pointer
+        ///     An allocation from this allocator.
+        ///
+        /// @return The mapping header for the given allocation.
+        ///
+        static Mapping* GetMapping(void* pointer) noexcept;
+
+        PageAllocator(PageAllocator&) = delete;
+        PageAllocator& operator=(PageAllocator&) = delete;
+        PageAllocator(PageAllocator&&) = delete;
+        PageAllocator& operator=(PageAllocator&&) = delete;
+
+        const HugePageMode m_hugePageMode;
+        const std::size_t m_pageSize;
+
+        std::atomic<std::size_t> m_allocationCount;
+    };
+}
+
+#endif
@@ -24,107 +24,315 @@
 
 #include "PagedBlockAllocator.h"
 
+#include "../Utility/MemoryUtils.h"
+#include "../Utility/VirtualMemoryUtils.h"
+
+#include <algorithm>
 #include <cassert>
+#include <new>
 
 namespace IC
 {
+    namespace
+    {
+        /// @param bufferSize
+        ///     The size of the buffer available for the block allocator.
+        /// @param blockSize
+        ///     The size of each block.
+        /// @param trackAllocatedBlocks
+        ///     Whether or not the allocated blocks are tracked.
+        ///
+        /// @return The largest number of blocks which, along with their allocated block 
+        /// bitmap if tracked, fit in a buffer of the given size.
+        ///
+        std::size_t CalcNumBlocksInBuffer(std::size_t bufferSize, std::size_t blockSize, bool trackAllocatedBlocks) noexcept
+        {
+            auto numBlocks = trackAllocatedBlocks ? (bufferSize * 8) / (blockSize * 8 + 1) : bufferSize / blockSize;
+            while (BlockAllocator::CalcBufferSize(blockSize, numBlocks, trackAllocatedBlocks) > bufferSize)
+            {
+                --numBlocks;
+            }
+
+            return numBlocks;
+        }
+    }
 
     //------------------------------------------------------------------------------
-    PagedBlockAllocator::PagedBlockAllocator(std::size_t blockSize, std::size_t numBlocksPerPage) noexcept
-        : m_blockSize(blockSize), m_numBlocksPerPage(numBlocksPerPage), m_pageSize(m_blockSize * m_numBlocksPerPage), m_freeStoreBlockAllocators()
+    PagedBlockAllocator::Page::Page(void* buffer, std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks) noexcept
+        : m_blockAllocator(buffer, blockSize, numBlocks, trackAllocatedBlocks)
     {
-        m_freeStoreBlockAllocators.push_back(std::unique_ptr<BlockAllocator>(new BlockAllocator(m_blockSize, m_numBlocksPerPage)));
     }
 
     //------------------------------------------------------------------------------
-    PagedBlockAllocator::PagedBlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocksPerPage) noexcept
-        : m_blockSize(blockSize), m_numBlocksPerPage(numBlocksPerPage), m_pageSize(m_blockSize * m_numBlocksPerPage), m_parentAllocator(&parentAllocator),
-        m_parentAllocatorBlockAllocators(MakeVector<UniquePtr<BlockAllocator>>(*m_parentAllocator))
+    PagedBlockAllocator::PagedBlockAllocator(std::size_t blockSize, std::size_t numBlocksPerPage, std::size_t maxEmptyPages, bool trackAllocatedBlocks) noexcept
+        : m_blockSize(blockSize), m_trackAllocatedBlocks(trackAllocatedBlocks), m_pageHeaderSize(MemoryUtils::Align(sizeof(Page), BlockAllocator::CalcBufferAlignment(m_blockSize))),
+        m_pageSize(std::max(MemoryUtils::NextPowerofTwo(m_pageHeaderSize + BlockAllocator::CalcBufferSize(m_blockSize, numBlocksPerPage, m_trackAllocatedBlocks)), VirtualMemoryUtils::GetPageSize())), 
+        m_numBlocksPerPage(CalcNumBlocksInBuffer(m_pageSize - m_pageHeaderSize, m_blockSize, m_trackAllocatedBlocks)),
+        m_maxEmptyPages(maxEmptyPages)
     {
-        m_parentAllocatorBlockAllocators.push_back(MakeUnique<BlockAllocator>(*m_parentAllocator, *m_parentAllocator, m_blockSize, m_numBlocksPerPage));
+        assert(numBlocksPerPage > 0);
+
+        CreatePage();
     }
 
     //------------------------------------------------------------------------------
-    std::size_t PagedBlockAllocator::GetNumPages() const noexcept
+    PagedBlockAllocator::PagedBlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocksPerPage, std::size_t maxEmptyPages, bool trackAllocatedBlocks) noexcept
+        : m_blockSize(blockSize), m_trackAllocatedBlocks(trackAllocatedBlocks), m_pageHeaderSize(MemoryUtils::Align(sizeof(Page), BlockAllocator::CalcBufferAlignment(m_blockSize))),
+        m_pageSize(MemoryUtils::NextPowerofTwo(m_pageHeaderSize + BlockAllocator::CalcBufferSize(m_blockSize, numBlocksPerPage, m_trackAllocatedBlocks))), 
+        m_numBlocksPerPage(CalcNumBlocksInBuffer(m_pageSize - m_pageHeaderSize, m_blockSize, m_trackAllocatedBlocks)),
+        m_maxEmptyPages(maxEmptyPages), m_parentAllocator(&parentAllocator)
     {
-        if (m_parentAllocator)
+        assert(numBlocksPerPage > 0);
+
+        CreatePage();
+    }
+
+    //------------------------------------------------------------------------------
+    void* PagedBlockAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        auto page = m_firstNonFullPage ? m_firstNonFullPage : CreatePage();
+
+        if (page->m_blockAllocator.GetNumAllocatedBlocks() == 0)
         {
-            return m_parentAllocatorBlockAllocators.size();
+            --m_numEmptyPages;
         }
-        else
+
+        auto block = page->m_blockAllocator.Allocate(allocationSize);
+        if (page->m_blockAllocator.GetNumFreeBlocks() == 0)
         {
-            return m_freeStoreBlockAllocators.size();
+            RemoveNonFullPage(page);
         }
+
+        return block;
     }
 
     //------------------------------------------------------------------------------
-    void* PagedBlockAllocator::Allocate(std::size_t allocationSize) noexcept
+    void* PagedBlockAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
     {
-        if (m_parentAllocator)
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+        assert(MemoryUtils::IsAligned(m_blockSize, alignment));
+
+        auto block = Allocate(allocationSize);
+        assert(MemoryUtils::IsAligned(reinterpret_cast<std::uintptr_t>(block), alignment));
+
+        return block;
+    }
+
+    //------------------------------------------------------------------------------
+    void PagedBlockAllocator::Deallocate(void* pointer) noexcept
+    {
+        auto page = GetPage(pointer);
+        auto wasFull = (page->m_blockAllocator.GetNumFreeBlocks() == 0);
+
+        page->m_blockAllocator.Deallocate(pointer);
+
+        if (wasFull)
+        {
+            PushNonFullPage(page);
+        }
+        else if (page->m_blockAllocator.GetNumAllocatedBlocks() == m_numBlocksPerPage / 2 && page != m_lastNonFullPage)
+        {
+            RemoveNonFullPage(page);
+            AppendNonFullPage(page);
+        }
+
+        if (page->m_blockAllocator.GetNumAllocatedBlocks() == 0)
         {
-            for (const auto& blockAllocator : m_parentAllocatorBlockAllocators)
+            ++m_numEmptyPages;
+
+            if (m_numEmptyPages > m_maxEmptyPages)
             {
-                if (blockAllocator->GetNumFreeBlocks() > 0)
-                {
-                    return blockAllocator->Allocate(allocationSize);
-                }
+                ReleasePage(page);
             }
-
-            m_parentAllocatorBlockAllocators.push_back(MakeUnique<BlockAllocator>(*m_parentAllocator, *m_parentAllocator, m_blockSize, m_numBlocksPerPage));
-            return m_parentAllocatorBlockAllocators.back()->Allocate(allocationSize);
         }
-        else
+    }
+    
+    //------------------------------------------------------------------------------
+    bool PagedBlockAllocator::TryResizeInPlace(void* /*pointer*/, std::size_t newSize) noexcept
+    {
+        return newSize <= m_blockSize;
+    }
+
+    //------------------------------------------------------------------------------
+    void PagedBlockAllocator::Trim() noexcept
+    {
+        auto page = m_firstPage;
+        while (page)
         {
-            for (const auto& blockAllocator : m_freeStoreBlockAllocators)
+            auto next = page->m_next;
+            if (page->m_blockAllocator.GetNumAllocatedBlocks() == 0)
             {
-                if (blockAllocator->GetNumFreeBlocks() > 0)
-                {
-                    return blockAllocator->Allocate(allocationSize);
-                }
+                ReleasePage(page);
             }
 
-            m_freeStoreBlockAllocators.push_back(std::unique_ptr<BlockAllocator>(new BlockAllocator(m_blockSize, m_numBlocksPerPage)));
-            return m_freeStoreBlockAllocators.back()->Allocate(allocationSize);
+            page = next;
         }
+
+        assert(m_numEmptyPages == 0);
     }
 
     //------------------------------------------------------------------------------
-    void PagedBlockAllocator::Deallocate(void* pointer) noexcept
+    PagedBlockAllocator::Page* PagedBlockAllocator::CreatePage() noexcept
     {
+        void* pageBuffer;
         if (m_parentAllocator)
         {
-            for (const auto& blockAllocator : m_parentAllocatorBlockAllocators)
-            {
-                if (blockAllocator->ContainsBlock(pointer))
-                {
-                    return blockAllocator->Deallocate(pointer);
-                }
-            }
+            pageBuffer = m_parentAllocator->Allocate(m_pageSize, m_pageSize);
         }
         else
         {
-            for (const auto& blockAllocator : m_freeStoreBlockAllocators)
+            pageBuffer = VirtualMemoryUtils::ReserveAligned(m_pageSize, m_pageSize);
+            if (pageBuffer && !VirtualMemoryUtils::Commit(pageBuffer, m_pageSize))
             {
-                if (blockAllocator->ContainsBlock(pointer))
-                {
-                    return blockAllocator->Deallocate(pointer);
-                }
+                VirtualMemoryUtils::Release(pageBuffer, m_pageSize);
+                pageBuffer = nullptr;
             }
         }
 
-        assert(false);
+        assert(pageBuffer);
+        assert(MemoryUtils::IsAligned(reinterpret_cast<std::uintptr_t>(pageBuffer), m_pageSize));
+
+        auto page = new (pageBuffer) Page(reinterpret_cast<std::uint8_t*>(pageBuffer) + m_pageHeaderSize, m_blockSize, m_numBlocksPerPage, m_trackAllocatedBlocks);
+        page->m_next = m_firstPage;
+        if (m_firstPage)
+        {
+            m_firstPage->m_previous = page;
+        }
+
+        m_firstPage = page;
+        AppendNonFullPage(page);
+
+        ++m_numPages;
+        ++m_numEmptyPages;
+
+        return page;
     }
-    
+
     //------------------------------------------------------------------------------
-    PagedBlockAllocator::~PagedBlockAllocator() noexcept
+    void PagedBlockAllocator::DestroyPage(Page* page) noexcept
     {
+        page->~Page();
+
         if (m_parentAllocator)
         {
-            m_parentAllocatorBlockAllocators.~vector();
+            m_parentAllocator->Deallocate(page);
+        }
+        else
+        {
+            VirtualMemoryUtils::Release(page, m_pageSize);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void PagedBlockAllocator::ReleasePage(Page* page) noexcept
+    {
+        assert(page->m_blockAllocator.GetNumAllocatedBlocks() == 0);
+
+        RemoveNonFullPage(page);
+
+        if (page->m_previous)
+        {
+            page->m_previous->m_next = page->m_next;
+        }
+        else
+        {
+            m_firstPage = page->m_next;
+        }
+
+        if (page->m_next)
+        {
+            page->m_next->m_previous = page->m_previous;
+        }
+
+        --m_numPages;
+        --m_numEmptyPages;
+
+        DestroyPage(page);
+    }
+
+    //------------------------------------------------------------------------------
+    void PagedBlockAllocator::PushNonFullPage(Page* page) noexcept
+    {
+        assert(!page->m_previousNonFull && !page->m_nextNonFull && page != m_firstNonFullPage);
+
+        page->m_nextNonFull = m_firstNonFullPage;
+        if (m_firstNonFullPage)
+        {
+            m_firstNonFullPage->m_previousNonFull = page;
+        }
+        else
+        {
+            m_lastNonFullPage = page;
+        }
+
+        m_firstNonFullPage = page;
+    }
+
+    //------------------------------------------------------------------------------
+    void PagedBlockAllocator::AppendNonFullPage(Page* page) noexcept
+    {
+        assert(!page->m_previousNonFull && !page->m_nextNonFull && page != m_lastNonFullPage);
+
+        page->m_previousNonFull = m_lastNonFullPage;
+        if (m_lastNonFullPage)
+        {
+            m_lastNonFullPage->m_nextNonFull = page;
+        }
+        else
+        {
+            m_firstNonFullPage = page;
+        }
+
+        m_lastNonFullPage = page;
+    }
+
+    //------------------------------------------------------------------------------
+    void PagedBlockAllocator::RemoveNonFullPage(Page* page) noexcept
+    {
+        if (page->m_previousNonFull)
+        {
+            page->m_previousNonFull->m_nextNonFull = page->m_nextNonFull;
+        }
+        else
+        {
+            assert(m_firstNonFullPage == page);
+            m_firstNonFullPage = page->m_nextNonFull;
+        }
+
+        if (page->m_nextNonFull)
+        {
+            page->m_nextNonFull->m_previousNonFull = page->m_previousNonFull;
         }
         else
         {
-            m_freeStoreBlockAllocators.~vector();
+            assert(m_lastNonFullPage == page);
+            m_lastNonFullPage = page->m_previousNonFull;
+        }
+
+        page->m_nextNonFull = nullptr;
+        page->m_previousNonFull = nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    PagedBlockAllocator::Page* PagedBlockAllocator::GetPage(void* pointer) const noexcept
+    {
+        assert(pointer);
+
+        auto page = reinterpret_cast<Page*>(reinterpret_cast<std::uintptr_t>(pointer) & ~(m_pageSize - 1));
+        assert(page->m_blockAllocator.ContainsBlock(pointer));
+
+        return page;
+    }
+
+    //------------------------------------------------------------------------------
+    PagedBlockAllocator::~PagedBlockAllocator() noexcept
+    {
+        auto page = m_firstPage;
+        while (page)
+        {
+            auto next = page->m_next;
+            DestroyPage(page);
+            page = next;
         }
     }
-}
\ No newline at end of file
+}
@@ -26,17 +26,39 @@
 #define _ICMEMORY_ALLOCATOR_PAGEDBLOCKALLOCATOR_H_
 
 #include "BlockAllocator.h"
-#include "../Container/UniquePtr.h"
-#include "../Container/Vector.h"
 
 namespace IC
 {
     /// A paged version of the PagedBlockAllocator. This allocates fixed size blocks of memory
     /// from pages. If an allocation is requested when no pages have any free blocks then
-    /// a new page is allocated. Pages are not deallocated until the allocator is destroyed.
+    /// a new page is allocated. When a page becomes empty it is kept for reuse, unless
+    /// the maximum number of empty pages has been reached, in which case it is released.
+    /// All empty pages can be released at any time by calling Trim().
+    ///
+    /// Each page is a power of two in size and is aligned to its size. The start of each
+    /// page contains a small header describing the page, which allows the page which owns
+    /// a block to be found by masking the block pointer. This means deallocation is O(1)
+    /// regardless of the number of pages. As the page size is rounded up to a power of two
+    /// the number of blocks per page may be greater than requested.
+    ///
+    /// Pages with free blocks are kept in a separate list, so allocation is also O(1). 
+    /// This list is loosely sorted by occupancy, fullest first, so allocations prefer
+    /// fuller pages, letting emptier pages drain. Pages which were full are added to the
+    /// front of the list when a block is freed, and pages which drop to half full are
+    /// moved to the back, as are new pages. This keeps updates O(1), at the cost of only
+    /// approximating the order: pages between the two ends are not sorted.
+    ///
+    /// Allocated blocks can optionally be tracked in each page, which is required by
+    /// ForEachAllocatedBlock(). This is off by default, as it costs a bitmap update on
+    /// every allocation and deallocation, and slightly reduces the blocks per page.
     ///
     /// A PagedBlockAllocator can be backed by other allocator types, from which pages will 
-    /// be allocated, otherwise they are allocated from the free store.
+    /// be allocated. The parent allocator must support allocations aligned to the page size,
+    /// and may need to reserve up to twice the page size to do so. Otherwise pages are
+    /// reserved directly from the operating system, which can provide size aligned pages
+    /// without that overhead. In this case the page size is at least the virtual memory
+    /// page size, and as blocks are only touched when first allocated, memory for unused
+    /// blocks in a page is never faulted in.
     ///
     /// Note that this is not thread-safe and should not be accessed from multiple
     /// threads at the same time.
@@ -44,15 +66,24 @@ namespace IC
     class PagedBlockAllocator final : public IAllocator
     {
     public:
-        /// Creates a new PagedBlockAllocator with pages allocated from the free store.
+        static constexpr std::size_t k_defaultMaxEmptyPages = 1;
+
+        /// Creates a new PagedBlockAllocator with pages reserved from the operating system.
+        /// The page size is at least the virtual memory page size.
         ///
         /// @param blockSize
         ///        The size of each block in the allocator. The block size must be multiple
-        ///        of the size of a pointer, at at least twice the size of a pointer.
+        ///        of the size of a pointer, and at least the size of a pointer.
         /// @param numBlocksPerPage
-        ///        The number of blocks available in each page.
+        ///        The minimum number of blocks available in each page.
+        /// @param maxEmptyPages
+        ///        Optional. The maximum number of empty pages which are kept for reuse. 
+        ///        Defaults to k_defaultMaxEmptyPages.
+        /// @param trackAllocatedBlocks
+        ///        Optional. Whether or not to keep a bitmap of allocated blocks in each
+        ///        page, which is required by ForEachAllocatedBlock(). Defaults to false.
         /// 
-        PagedBlockAllocator(std::size_t blockSize, std::size_t numBlocksPerPage) noexcept;
+        PagedBlockAllocator(std::size_t blockSize, std::size_t numBlocksPerPage, std::size_t maxEmptyPages = k_defaultMaxEmptyPages, bool trackAllocatedBlocks = false) noexcept;
 
         /// Creates a new PagedBlockAllocator with pages allocated from the given allocator.
         ///
@@ -60,11 +91,17 @@ namespace IC
         ///        The allocator from which to allocate pages.
         /// @param blockSize
         ///        The size of each block in the allocator. The block size must be multiple
-        ///        of the size of a pointer, at at least twice the size of a pointer.
+        ///        of the size of a pointer, and at least the size of a pointer.
         /// @param numBlocksPerPage
-        ///        The number of blocks available in each page.
+        ///        The minimum number of blocks available in each page.
+        /// @param maxEmptyPages
+        ///        Optional. The maximum number of empty pages which are kept for reuse. 
+        ///        Defaults to k_defaultMaxEmptyPages.
+        /// @param trackAllocatedBlocks
+        ///        Optional. Whether or not to keep a bitmap of allocated blocks in each
+        ///        page, which is required by ForEachAllocatedBlock(). Defaults to false.
         /// 
-        PagedBlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocksPerPage) noexcept;
+        PagedBlockAllocator(IAllocator& parentAllocator, std::size_t blockSize, std::size_t numBlocksPerPage, std::size_t maxEmptyPages = k_defaultMaxEmptyPages, bool trackAllocatedBlocks = false) noexcept;
 
         /// This is thread safe.
         ///
@@ -81,17 +118,43 @@ namespace IC
 
         /// This is thread-safe.
         ///
-        /// @return The total number of blocks available in each page.
+        /// @return The total number of blocks available in each page. This may be greater
+        /// than the number requested.
         ///
         std::size_t GetNumBlocksPerPage() const noexcept { return m_numBlocksPerPage; }
 
+        /// This is thread-safe.
+        ///
+        /// @return The size of each page, including the page header. This will always be
+        /// a power of two.
+        ///
+        std::size_t GetPageSize() const noexcept { return m_pageSize; }
+
         /// @return The number of pages in the allocator.
         ///
-        std::size_t GetNumPages() const noexcept;
+        std::size_t GetNumPages() const noexcept { return m_numPages; }
+
+        /// @return The number of pages in the allocator which have no allocated blocks.
+        ///
+        std::size_t GetNumEmptyPages() const noexcept { return m_numEmptyPages; }
+
+        /// This is thread-safe.
+        ///
+        /// @return The maximum number of empty pages which are kept for reuse.
+        ///
+        std::size_t GetMaxEmptyPages() const noexcept { return m_maxEmptyPages; }
+
+        /// This is thread-safe.
+        ///
+        /// @return Whether or not allocated blocks are tracked, allowing
+        /// ForEachAllocatedBlock() to be used.
+        ///
+        bool IsTrackingAllocatedBlocks() const noexcept { return m_trackAllocatedBlocks; }
 
         /// Allocates a block from the allocator. The allocation size must be smaller than 
-        /// that of a block, otherwise this will assert. If there are no free blocks in any
-        /// available pages, then a new page will be allocated.
+        /// that of a block, otherwise this will assert. The block is taken from the first
+        /// page with free blocks. If there are no free blocks in any available pages, then
+        /// a new page will be allocated.
         ///
         /// @param allocationSize
         ///        The size of allocation required.
@@ -100,33 +163,158 @@ namespace IC
         ///
         void* Allocate(std::size_t allocationSize) noexcept override;
 
-        /// Deallocates the given block, freeing it for reuse.
+        /// Allocates a block from the allocator. The allocation size must be smaller than 
+        /// that of a block and every block must meet the requested alignment, otherwise 
+        /// this will assert. Blocks are aligned to the largest power of two which the block
+        /// size is a multiple of, up to 4096 bytes.
+        ///
+        /// @param allocationSize
+        ///        The size of allocation required.
+        /// @param alignment
+        ///        The alignment required. Must be a power of two.
+        ///
+        /// @return The block of memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
+        /// Deallocates the given block, freeing it for reuse. The page which owns the
+        /// block is found from the block pointer, so this is O(1). If this leaves the page
+        /// empty and there are more than the maximum number of empty pages, the page is 
+        /// released.
         ///
         /// @param pointer
         ///        The pointer which should be deallocated.
         ///
         void Deallocate(void* pointer) noexcept override;
 
+        /// Resizing a block in place succeeds if the new size still fits in a single block.
+        ///
+        /// @param pointer
+        ///        The block which should be resized.
+        /// @param newSize
+        ///        The requested size of the allocation.
+        ///
+        /// @return Whether or not the new size fits in the block.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
+        /// Releases all empty pages, returning their memory either to the parent allocator
+        /// or the operating system.
+        ///
+        void Trim() noexcept;
+
+        /// Calls the given function for each allocated block, page by page. Within each
+        /// page the blocks are visited in address order, using the page's allocated block
+        /// bitmap, so the allocator must have been created with block tracking enabled.
+        /// Blocks must not be allocated or deallocated while iterating.
+        ///
+        /// @param function
+        ///        The function to call, which takes a pointer to the block.
+        ///
+        template <typename TFunction> void ForEachAllocatedBlock(TFunction&& function) const noexcept;
+
         ~PagedBlockAllocator() noexcept;
 
     private:
+        /// The header stored at the start of each page. The blocks in the page follow
+        /// the header.
+        ///
+        struct Page final
+        {
+            /// Creates a new page header, with the block allocator using the given
+            /// buffer.
+            ///
+            /// @param buffer
+            ///     The buffer from which blocks will be allocated.
+            /// @param blockSize
+            ///     The size of each block.
+            /// @param numBlocks
+            ///     The number of blocks in the buffer.
+            /// @param trackAllocatedBlocks
+            ///     Whether or not the block allocator tracks allocated blocks.
+            ///
+            Page(void* buffer, std::size_t blockSize, std::size_t numBlocks, bool trackAllocatedBlocks) noexcept;
+
+            BlockAllocator m_blockAllocator;
+            Page* m_next = nullptr;
+            Page* m_previous = nullptr;
+            Page* m_nextNonFull = nullptr;
+            Page* m_previousNonFull = nullptr;
+        };
+
         PagedBlockAllocator(PagedBlockAllocator&) = delete;
         PagedBlockAllocator& operator=(PagedBlockAllocator&) = delete;
         PagedBlockAllocator(PagedBlockAllocator&&) = delete;
         PagedBlockAllocator& operator=(PagedBlockAllocator&&) = delete;
 
+        /// Allocates a new page, either from the parent allocator or the operating system,
+        /// and adds it to both the page list and the non-full page list.
+        ///
+        /// @return The new page.
+        ///
+        Page* CreatePage() noexcept;
+
+        /// Destroys the given page, returning its memory either to the parent allocator
+        /// or the operating system. This does not remove the page from the page lists.
+        ///
+        /// @param page
+        ///     The page which should be destroyed.
+        ///
+        void DestroyPage(Page* page) noexcept;
+
+        /// Removes the given empty page from the page list and non-full page list, then
+        /// destroys it.
+        ///
+        /// @param page
+        ///     The empty page which should be released.
+        ///
+        void ReleasePage(Page* page) noexcept;
+
+        /// Adds the given page to the front of the non-full page list.
+        ///
+        /// @param page
+        ///     The page, which must not already be in the list.
+        ///
+        void PushNonFullPage(Page* page) noexcept;
+
+        /// Adds the given page to the back of the non-full page list.
+        ///
+        /// @param page
+        ///     The page, which must not already be in the list.
+        ///
+        void AppendNonFullPage(Page* page) noexcept;
+
+        /// Removes the given page from the non-full page list.
+        ///
+        /// @param page
+        ///     The page, which must be in the list.
+        ///
+        void RemoveNonFullPage(Page* page) noexcept;
+
+        /// @param pointer
+        ///     A pointer to a block which was allocated from this allocator.
+        ///
+        /// @return The page which owns the given block.
+        ///
+        Page* GetPage(void* pointer) const noexcept;
+
         const std::size_t m_blockSize;
-        const std::size_t m_numBlocksPerPage;
+        const bool m_trackAllocatedBlocks;
+        const std::size_t m_pageHeaderSize;
         const std::size_t m_pageSize;
+        const std::size_t m_numBlocksPerPage;
+        const std::size_t m_maxEmptyPages;
 
         IAllocator* m_parentAllocator = nullptr;
 
-        union
-        {
-            std::vector<std::unique_ptr<BlockAllocator>> m_freeStoreBlockAllocators;
-            Vector<UniquePtr<BlockAllocator>> m_parentAllocatorBlockAllocators;
-        };
+        Page* m_firstPage = nullptr;
+        Page* m_firstNonFullPage = nullptr;
+        Page* m_lastNonFullPage = nullptr;
+        std::size_t m_numPages = 0;
+        std::size_t m_numEmptyPages = 0;
     };
 }
 
+#include "PagedBlockAllocatorImpl.h"
+
 #endif
\ No newline at end of file
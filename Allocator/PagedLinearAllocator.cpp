@@ -24,6 +24,8 @@
 
 #include "PagedLinearAllocator.h"
 
+#include "../Utility/MemoryUtils.h"
+
 #include <cassert>
 
 namespace IC
@@ -32,14 +34,14 @@ namespace IC
     PagedLinearAllocator::PagedLinearAllocator(std::size_t pageSize) noexcept
         : m_pageSize(pageSize), m_freeStoreLinearAllocators()
     {
-        m_freeStoreLinearAllocators.push_back(std::unique_ptr<LinearAllocator>(new LinearAllocator(m_pageSize)));
+        CreatePage();
     }
 
     //------------------------------------------------------------------------------
     PagedLinearAllocator::PagedLinearAllocator(IAllocator& parentAllocator, std::size_t pageSize) noexcept
         : m_pageSize(pageSize), m_parentAllocator(&parentAllocator), m_parentAllocatorLinearAllocators(MakeVector<UniquePtr<LinearAllocator>>(*m_parentAllocator))
     {
-        m_parentAllocatorLinearAllocators.push_back(MakeUnique<LinearAllocator>(*m_parentAllocator, *m_parentAllocator, m_pageSize));
+        CreatePage();
     }
 
     //------------------------------------------------------------------------------
@@ -58,61 +60,86 @@ namespace IC
     //------------------------------------------------------------------------------
     void* PagedLinearAllocator::Allocate(std::size_t allocationSize) noexcept
     {
-        assert(allocationSize <= GetMaxAllocationSize());
+        return Allocate(allocationSize, sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    void* PagedLinearAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        // Pages are only guaranteed to be pointer aligned, so the allocation must fit in
+        // a new page even with the worst case padding, otherwise this would keep creating
+        // pages until one happened to be suitably aligned.
+        auto padding = (alignment > sizeof(std::intptr_t)) ? alignment - sizeof(std::intptr_t) : 0;
+        assert(MemoryUtils::Align(allocationSize, sizeof(std::intptr_t)) + padding <= (m_pageSize & ~(sizeof(std::intptr_t) - 1)));
+        (void)padding;
+
+        while (GetPage(m_currentPage)->GetFreeSpace(alignment) < allocationSize)
+        {
+            ++m_currentPage;
+            if (m_currentPage == GetNumPages())
+            {
+                CreatePage();
+            }
+        }
 
+        return GetPage(m_currentPage)->Allocate(allocationSize, alignment);
+    }
+
+    //------------------------------------------------------------------------------
+    void PagedLinearAllocator::Deallocate(void* pointer) noexcept
+    {
         if (m_parentAllocator)
         {
             for (const auto& blockAllocator : m_parentAllocatorLinearAllocators)
             {
-                if (blockAllocator->GetFreeSpace() >= allocationSize)
+                if (blockAllocator->Contains(pointer))
                 {
-                    return blockAllocator->Allocate(allocationSize);
+                    return blockAllocator->Deallocate(pointer);
                 }
             }
-
-            m_parentAllocatorLinearAllocators.push_back(MakeUnique<LinearAllocator>(*m_parentAllocator, *m_parentAllocator, m_pageSize));
-            return m_parentAllocatorLinearAllocators.back()->Allocate(allocationSize);
         }
         else
         {
             for (const auto& blockAllocator : m_freeStoreLinearAllocators)
             {
-                if (blockAllocator->GetFreeSpace() >= allocationSize)
+                if (blockAllocator->Contains(pointer))
                 {
-                    return blockAllocator->Allocate(allocationSize);
+                    return blockAllocator->Deallocate(pointer);
                 }
             }
-
-            m_freeStoreLinearAllocators.push_back(std::unique_ptr<LinearAllocator>(new LinearAllocator(m_pageSize)));
-            return m_freeStoreLinearAllocators.back()->Allocate(allocationSize);
         }
+
+        assert(false);
     }
 
     //------------------------------------------------------------------------------
-    void PagedLinearAllocator::Deallocate(void* pointer) noexcept
+    bool PagedLinearAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
     {
         if (m_parentAllocator)
         {
-            for (const auto& blockAllocator : m_parentAllocatorLinearAllocators)
+            for (const auto& linearAllocator : m_parentAllocatorLinearAllocators)
             {
-                if (blockAllocator->Contains(pointer))
+                if (linearAllocator->Contains(pointer))
                 {
-                    return blockAllocator->Deallocate(pointer);
+                    return linearAllocator->TryResizeInPlace(pointer, newSize);
                 }
             }
         }
         else
         {
-            for (const auto& blockAllocator : m_freeStoreLinearAllocators)
+            for (const auto& linearAllocator : m_freeStoreLinearAllocators)
             {
-                if (blockAllocator->Contains(pointer))
+                if (linearAllocator->Contains(pointer))
                 {
-                    return blockAllocator->Deallocate(pointer);
+                    return linearAllocator->TryResizeInPlace(pointer, newSize);
                 }
             }
         }
 
         assert(false);
+        return false;
     }
 
     //------------------------------------------------------------------------------
@@ -132,6 +159,8 @@ namespace IC
                 allocator->Reset();
             }
         }
+
+        m_currentPage = 0;
     }
 
     //------------------------------------------------------------------------------
@@ -155,6 +184,58 @@ namespace IC
         }
     }
 
+    //------------------------------------------------------------------------------
+    PagedLinearAllocator::Marker PagedLinearAllocator::GetMarker() const noexcept
+    {
+        Marker marker;
+        marker.m_pageIndex = m_currentPage;
+        marker.m_pageMarker = GetPage(m_currentPage)->GetMarker();
+
+        return marker;
+    }
+
+    //------------------------------------------------------------------------------
+    void PagedLinearAllocator::RewindTo(const Marker& marker) noexcept
+    {
+        assert(marker.m_pageIndex <= m_currentPage);
+
+        for (auto pageIndex = marker.m_pageIndex + 1; pageIndex <= m_currentPage; ++pageIndex)
+        {
+            GetPage(pageIndex)->Reset();
+        }
+
+        GetPage(marker.m_pageIndex)->RewindTo(marker.m_pageMarker);
+        m_currentPage = marker.m_pageIndex;
+    }
+
+    //------------------------------------------------------------------------------
+    LinearAllocator* PagedLinearAllocator::GetPage(std::size_t index) const noexcept
+    {
+        assert(index < GetNumPages());
+
+        if (m_parentAllocator)
+        {
+            return m_parentAllocatorLinearAllocators[index].get();
+        }
+        else
+        {
+            return m_freeStoreLinearAllocators[index].get();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void PagedLinearAllocator::CreatePage() noexcept
+    {
+        if (m_parentAllocator)
+        {
+            m_parentAllocatorLinearAllocators.push_back(MakeUnique<LinearAllocator>(*m_parentAllocator, *m_parentAllocator, m_pageSize));
+        }
+        else
+        {
+            m_freeStoreLinearAllocators.push_back(std::unique_ptr<LinearAllocator>(new LinearAllocator(m_pageSize)));
+        }
+    }
+
     //------------------------------------------------------------------------------
     PagedLinearAllocator::~PagedLinearAllocator() noexcept
     {
@@ -35,8 +35,12 @@ namespace IC
     /// simply moving the next allocation pointer through the buffer by the size of the
     /// allocation. All allocations are 'deallocated' at the same time by resetting the 
     /// allocation pointer back to the start of the buffer. If an allocation will not
-    /// fit in the current buffer then a new page is allocated. Once a page has been
-    /// allocated it will not be deallocated until ResetAndShink() is called.
+    /// fit in the current page then allocation moves on to the next page, which is
+    /// allocated if it doesn't yet exist. Once a page has been allocated it will not be
+    /// deallocated until ResetAndShink() is called.
+    ///
+    /// As with LinearAllocator, a marker can be taken and the allocator later rewound to
+    /// it. Markers can span pages.
     ///
     /// A PagedLinearAllocator can be backed by other allocator types, from which pages 
     /// will be allocated, otherwise they are allocated from the free store.
@@ -49,6 +53,15 @@ namespace IC
     public:
         static constexpr std::size_t k_defaultPageSize = 4 * 1024;
 
+        /// A position in the allocator which it can later be rewound to. This should be
+        /// treated as opaque.
+        ///
+        struct Marker final
+        {
+            std::size_t m_pageIndex = 0;
+            LinearAllocator::Marker m_pageMarker;
+        };
+
         /// Initialises a new PagedLinearAllocator with the given page size. Pages will be allocated
         /// from the free store.
         ///
@@ -85,8 +98,8 @@ namespace IC
         std::size_t GetNumPages() const noexcept;
 
         /// Allocates a new block of memory of the requested size. If there is no space left in the
-        /// buffer for the alloaction then a new page will be allocated. Allocations must be smaller
-        /// than the size of a single page.
+        /// current page for the alloaction then the next page will be used, allocating it if needed.
+        /// Allocations must be smaller than the size of a single page.
         ///
         /// @param allocationSize
         ///     The size of the allocation.
@@ -95,6 +108,21 @@ namespace IC
         ///
         void* Allocate(std::size_t allocationSize) noexcept override;
 
+        /// Allocates a new block of memory of the requested size and alignment. If there is no
+        /// space left in the current page for the alloaction then the next page will be used,
+        /// allocating it if needed. Pages are only guaranteed to be pointer aligned, so the
+        /// allocation plus the worst case alignment padding, alignment - sizeof(std::intptr_t),
+        /// must fit within a single page.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
         /// Decriments the allocation count. This is checked when resetting to ensure that all previously
         /// allocated memory has been deallocated.
         ///
@@ -103,6 +131,19 @@ namespace IC
         ///
         void Deallocate(void* pointer) noexcept override;
 
+        /// Attempts to resize the given allocation without moving it. This is only possible
+        /// for the most recent allocation in a page, which can grow into the remaining free
+        /// space in that page, or shrink.
+        ///
+        /// @param pointer
+        ///     The allocation which should be resized.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return Whether or not the allocation was resized.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
         /// Resets the buffer, allowing all previously allocated memory to be reused. Deallocate() must
         /// have been called for all allocated blocks prior to reset() being called.
         /// 
@@ -112,6 +153,20 @@ namespace IC
         /// 
         void ResetAndShrink() noexcept;
 
+        /// @return A marker for the current position in the allocator.
+        ///
+        Marker GetMarker() const noexcept;
+
+        /// Rewinds the allocator to the given marker, allowing all memory allocated since the
+        /// marker was taken to be reused, including in later pages. Deallocate() must have been
+        /// called for all blocks allocated since the marker was taken. The allocator must not
+        /// have been reset or rewound to an earlier marker since the marker was taken.
+        ///
+        /// @param marker
+        ///     The marker to rewind to.
+        ///
+        void RewindTo(const Marker& marker) noexcept;
+
         ~PagedLinearAllocator() noexcept;
 
     private:
@@ -120,9 +175,21 @@ namespace IC
         PagedLinearAllocator(PagedLinearAllocator&&) = delete;
         PagedLinearAllocator& operator=(PagedLinearAllocator&&) = delete;
 
+        /// @param index
+        ///     The index of the page. Must be less than the number of pages.
+        ///
+        /// @return The page with the given index.
+        ///
+        LinearAllocator* GetPage(std::size_t index) const noexcept;
+
+        /// Allocates a new page and adds it to the end of the page list.
+        ///
+        void CreatePage() noexcept;
+
         const std::size_t m_pageSize;
 
         IAllocator* m_parentAllocator = nullptr;
+        std::size_t m_currentPage = 0;
 
         union
         {
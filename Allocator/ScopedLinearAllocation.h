@@ -0,0 +1,66 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef _ICMEMORY_ALLOCATOR_SCOPEDLINEARALLOCATION_H_
+#define _ICMEMORY_ALLOCATOR_SCOPEDLINEARALLOCATION_H_
+
+namespace IC
+{
+    /// Takes a marker from the given linear allocator on construction, and rewinds the
+    /// allocator to it on destruction. This allows scratch memory to be allocated for
+    /// the duration of a scope, without resetting allocations made before the scope
+    /// began. Scopes can be nested. All allocations made within the scope must be
+    /// deallocated before the scope ends.
+    ///
+    /// This can be used with a LinearAllocator, PagedLinearAllocator or VirtualLinearAllocator.
+    ///
+    template <typename TLinearAllocator> class ScopedLinearAllocation final
+    {
+    public:
+        /// Creates a new scoped allocation, taking a marker from the given allocator.
+        ///
+        /// @param allocator
+        ///        The linear allocator which should be rewound when the scope ends.
+        ///
+        ScopedLinearAllocation(TLinearAllocator& allocator) noexcept;
+
+        /// @return The allocator which is rewound when the scope ends.
+        ///
+        TLinearAllocator& GetAllocator() const noexcept { return m_allocator; }
+
+        ~ScopedLinearAllocation() noexcept;
+
+    private:
+        ScopedLinearAllocation(ScopedLinearAllocation&) = delete;
+        ScopedLinearAllocation& operator=(ScopedLinearAllocation&) = delete;
+        ScopedLinearAllocation(ScopedLinearAllocation&&) = delete;
+        ScopedLinearAllocation& operator=(ScopedLinearAllocation&&) = delete;
+
+        TLinearAllocator& m_allocator;
+        const typename TLinearAllocator::Marker m_marker;
+    };
+}
+
+#include "ScopedLinearAllocationImpl.h"
+
+#endif
@@ -30,16 +30,16 @@ namespace IC
 {
     //------------------------------------------------------------------------------
     SmallObjectAllocator::SmallObjectAllocator(std::size_t bufferSize) noexcept
-        : m_level1Allocator(k_level1BlockSize, bufferSize / k_level1BlockSize), m_level2Allocator(k_level2BlockSize, bufferSize / k_level2BlockSize), 
-        m_level3Allocator(k_level3BlockSize, bufferSize / k_level3BlockSize), m_level4Allocator(k_level4BlockSize, bufferSize / k_level4BlockSize)
+        : m_level1Allocator(k_level1BlockSize, bufferSize / k_level1BlockSize), m_level2Allocator(k_level2BlockSize, bufferSize / k_level2BlockSize), m_level3Allocator(k_level3BlockSize, bufferSize / k_level3BlockSize), 
+        m_level4Allocator(k_level4BlockSize, bufferSize / k_level4BlockSize), m_level5Allocator(k_level5BlockSize, bufferSize / k_level5BlockSize)
     {
         assert(MemoryUtils::IsPowerOfTwo(bufferSize));
     }
 
     //------------------------------------------------------------------------------
     SmallObjectAllocator::SmallObjectAllocator(IAllocator& parentAllocator, std::size_t bufferSize) noexcept
-        : m_level1Allocator(parentAllocator, k_level1BlockSize, bufferSize / k_level1BlockSize), m_level2Allocator(parentAllocator, k_level2BlockSize, bufferSize / k_level2BlockSize),
-        m_level3Allocator(parentAllocator, k_level3BlockSize, bufferSize / k_level3BlockSize), m_level4Allocator(parentAllocator, k_level4BlockSize, bufferSize / k_level4BlockSize)
+        : m_level1Allocator(parentAllocator, k_level1BlockSize, bufferSize / k_level1BlockSize), m_level2Allocator(parentAllocator, k_level2BlockSize, bufferSize / k_level2BlockSize), m_level3Allocator(parentAllocator, k_level3BlockSize, bufferSize / k_level3BlockSize),
+        m_level4Allocator(parentAllocator, k_level4BlockSize, bufferSize / k_level4BlockSize), m_level5Allocator(parentAllocator, k_level5BlockSize, bufferSize / k_level5BlockSize)
     {
         assert(MemoryUtils::IsPowerOfTwo(bufferSize));
     }
@@ -47,7 +47,7 @@ namespace IC
     //------------------------------------------------------------------------------
     void* SmallObjectAllocator::Allocate(std::size_t allocationSize) noexcept
     {
-        auto roundedBlockSize = std::max(sizeof(std::intptr_t) * 2, MemoryUtils::NextPowerofTwo(allocationSize));
+        auto roundedBlockSize = std::max(sizeof(std::intptr_t), MemoryUtils::NextPowerofTwo(allocationSize));
 
         switch (roundedBlockSize)
         {
@@ -59,12 +59,22 @@ namespace IC
             return m_level3Allocator.Allocate(allocationSize);
         case k_level4BlockSize:
             return m_level4Allocator.Allocate(allocationSize);
+        case k_level5BlockSize:
+            return m_level5Allocator.Allocate(allocationSize);
         default:
             assert(false);
             return nullptr;
         }
     }
 
+    //------------------------------------------------------------------------------
+    void* SmallObjectAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        return Allocate(std::max(allocationSize, alignment));
+    }
+
     //------------------------------------------------------------------------------
     void SmallObjectAllocator::Deallocate(void* pointer) noexcept
     {
@@ -84,9 +94,78 @@ namespace IC
         {
             m_level4Allocator.Deallocate(pointer);
         }
+        else if (m_level5Allocator.ContainsBlock(pointer))
+        {
+            m_level5Allocator.Deallocate(pointer);
+        }
+        else
+        {
+            assert(false);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    void SmallObjectAllocator::Deallocate(void* pointer, std::size_t allocationSize) noexcept
+    {
+        auto roundedBlockSize = std::max(sizeof(std::intptr_t), MemoryUtils::NextPowerofTwo(allocationSize));
+
+        BlockAllocator* blockAllocator = nullptr;
+        switch (roundedBlockSize)
+        {
+        case k_level1BlockSize:
+            blockAllocator = &m_level1Allocator;
+            break;
+        case k_level2BlockSize:
+            blockAllocator = &m_level2Allocator;
+            break;
+        case k_level3BlockSize:
+            blockAllocator = &m_level3Allocator;
+            break;
+        case k_level4BlockSize:
+            blockAllocator = &m_level4Allocator;
+            break;
+        case k_level5BlockSize:
+            blockAllocator = &m_level5Allocator;
+            break;
+        }
+
+        if (blockAllocator && blockAllocator->ContainsBlock(pointer))
+        {
+            blockAllocator->Deallocate(pointer);
+        }
+        else
+        {
+            Deallocate(pointer);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    bool SmallObjectAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        if (m_level1Allocator.ContainsBlock(pointer))
+        {
+            return m_level1Allocator.TryResizeInPlace(pointer, newSize);
+        }
+        else if (m_level2Allocator.ContainsBlock(pointer))
+        {
+            return m_level2Allocator.TryResizeInPlace(pointer, newSize);
+        }
+        else if (m_level3Allocator.ContainsBlock(pointer))
+        {
+            return m_level3Allocator.TryResizeInPlace(pointer, newSize);
+        }
+        else if (m_level4Allocator.ContainsBlock(pointer))
+        {
+            return m_level4Allocator.TryResizeInPlace(pointer, newSize);
+        }
+        else if (m_level5Allocator.ContainsBlock(pointer))
+        {
+            return m_level5Allocator.TryResizeInPlace(pointer, newSize);
+        }
         else
         {
             assert(false);
+            return false;
         }
     }
 }
\ No newline at end of file
@@ -39,6 +39,8 @@ namespace IC
     /// A SmallObjectAllocator can be backed by other allocator types, from which pages 
     /// will be allocated, otherwise they are allocated from the free store.
     ///
+    /// Each object is aligned to the block size it is allocated from.
+    ///
     /// Note that this is not thread-safe and should not be accessed from multiple
     /// threads at the same time.
     ///
@@ -66,7 +68,7 @@ namespace IC
         /// @return The maximum allocator size that this can allocate. This will be 64 bytes for
         /// 32-bit architecture and 128 bytes for 64-bit.
         ///
-        std::size_t GetMaxAllocationSize() const noexcept override { return k_level4BlockSize; }
+        std::size_t GetMaxAllocationSize() const noexcept override { return k_level5BlockSize; }
 
         /// Allocates a new block of memory of the requested size. If there is no space left in the
         /// buffer for the alloaction then this will assert.
@@ -78,6 +80,19 @@ namespace IC
         ///
         void* Allocate(std::size_t allocationSize) noexcept override;
 
+        /// Allocates a new block of memory of the requested size and alignment. As each
+        /// block is aligned to its size, this will use the smallest block allocator which
+        /// is large enough for both the size and alignment.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
         /// Deallocates the given object, freeing it for reuse.
         ///
         /// @param pointer
@@ -85,11 +100,35 @@ namespace IC
         ///
         void Deallocate(void* pointer) noexcept override;
 
+        /// Deallocates the given memory, using the allocation size to go straight to the
+        /// block allocator for its size. If the memory isn't from that block allocator, for
+        /// example because it has since been resized, this falls back to Deallocate().
+        ///
+        /// @param pointer
+        ///     The memory which is to be freed.
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        void Deallocate(void* pointer, std::size_t allocationSize) noexcept override;
+
+        /// Resizing an object in place succeeds if the new size still fits in the block
+        /// which the object was allocated from.
+        ///
+        /// @param pointer
+        ///        The object which should be resized.
+        /// @param newSize
+        ///        The requested size of the allocation.
+        ///
+        /// @return Whether or not the new size fits in the block.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
     private:
-        static constexpr std::size_t k_level1BlockSize = sizeof(std::intptr_t) * 2;
-        static constexpr std::size_t k_level2BlockSize = sizeof(std::intptr_t) * 4;
-        static constexpr std::size_t k_level3BlockSize = sizeof(std::intptr_t) * 8;
-        static constexpr std::size_t k_level4BlockSize = sizeof(std::intptr_t) * 16;
+        static constexpr std::size_t k_level1BlockSize = sizeof(std::intptr_t);
+        static constexpr std::size_t k_level2BlockSize = sizeof(std::intptr_t) * 2;
+        static constexpr std::size_t k_level3BlockSize = sizeof(std::intptr_t) * 4;
+        static constexpr std::size_t k_level4BlockSize = sizeof(std::intptr_t) * 8;
+        static constexpr std::size_t k_level5BlockSize = sizeof(std::intptr_t) * 16;
 
         SmallObjectAllocator(SmallObjectAllocator&) = delete;
         SmallObjectAllocator& operator=(SmallObjectAllocator&) = delete;
@@ -100,6 +139,7 @@ namespace IC
         BlockAllocator m_level2Allocator;
         BlockAllocator m_level3Allocator;
         BlockAllocator m_level4Allocator;
+        BlockAllocator m_level5Allocator;
     };
 }
 
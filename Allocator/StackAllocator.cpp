@@ -0,0 +1,143 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "StackAllocator.h"
+
+#include "../Utility/MemoryUtils.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    StackAllocator::StackAllocator(std::size_t bufferSize) noexcept
+        : m_bufferSize(bufferSize)
+    {
+        assert(m_bufferSize > sizeof(Header));
+
+        m_buffer = reinterpret_cast<std::uint8_t*>(MemoryUtils::AllocateAligned(m_bufferSize, sizeof(std::intptr_t)));
+        m_top = m_buffer;
+    }
+
+    //------------------------------------------------------------------------------
+    StackAllocator::StackAllocator(IAllocator& parentAllocator, std::size_t bufferSize) noexcept
+        : m_bufferSize(bufferSize), m_parentAllocator(&parentAllocator)
+    {
+        assert(m_bufferSize > sizeof(Header));
+
+        m_buffer = reinterpret_cast<std::uint8_t*>(m_parentAllocator->Allocate(m_bufferSize, sizeof(std::intptr_t)));
+        m_top = m_buffer;
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t StackAllocator::GetMaxAllocationSize() const noexcept
+    {
+        return m_bufferSize - sizeof(Header);
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t StackAllocator::GetFreeSpace() const noexcept
+    {
+        return m_bufferSize - MemoryUtils::GetPointerOffset(m_top, m_buffer);
+    }
+
+    //------------------------------------------------------------------------------
+    void* StackAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        return Allocate(allocationSize, sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    void* StackAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        alignment = std::max(alignment, sizeof(std::intptr_t));
+
+        // Zero size allocations take a byte, so that one made when the buffer is full isn't
+        // given the end of the buffer.
+        allocationSize = std::max(allocationSize, std::size_t(1));
+
+        auto output = MemoryUtils::Align(m_top + sizeof(Header), alignment);
+        assert(MemoryUtils::GetPointerOffset(output, m_buffer) <= m_bufferSize);
+        assert(allocationSize <= m_bufferSize - MemoryUtils::GetPointerOffset(output, m_buffer));
+
+        auto header = reinterpret_cast<Header*>(output - sizeof(Header));
+        header->m_previousTop = m_top;
+        header->m_previousAllocation = m_lastAllocation;
+
+        m_top = std::min(MemoryUtils::Align(output + allocationSize, sizeof(std::intptr_t)), m_buffer + m_bufferSize);
+        m_lastAllocation = output;
+
+        return output;
+    }
+
+    //------------------------------------------------------------------------------
+    void StackAllocator::Deallocate(void* pointer) noexcept
+    {
+        assert(Contains(pointer));
+        assert(pointer == m_lastAllocation);
+
+        auto header = reinterpret_cast<Header*>(reinterpret_cast<std::uint8_t*>(pointer) - sizeof(Header));
+        m_top = header->m_previousTop;
+        m_lastAllocation = header->m_previousAllocation;
+    }
+
+    //------------------------------------------------------------------------------
+    bool StackAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        assert(Contains(pointer));
+
+        if (pointer != m_lastAllocation || newSize > m_bufferSize - MemoryUtils::GetPointerOffset(m_lastAllocation, m_buffer))
+        {
+            return false;
+        }
+
+        m_top = std::min(MemoryUtils::Align(m_lastAllocation + newSize, sizeof(std::intptr_t)), m_buffer + m_bufferSize);
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+    bool StackAllocator::Contains(void* pointer) const noexcept
+    {
+        return (pointer >= m_buffer && pointer < m_buffer + m_bufferSize);
+    }
+
+    //------------------------------------------------------------------------------
+    StackAllocator::~StackAllocator() noexcept
+    {
+        assert(m_lastAllocation == nullptr);
+
+        if (m_parentAllocator)
+        {
+            m_parentAllocator->Deallocate(m_buffer);
+        }
+        else
+        {
+            MemoryUtils::DeallocateAligned(m_buffer);
+        }
+
+        m_buffer = nullptr;
+    }
+}
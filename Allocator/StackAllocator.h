@@ -0,0 +1,166 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef _ICMEMORY_ALLOCATOR_STACKALLOCATOR_H_
+#define _ICMEMORY_ALLOCATOR_STACKALLOCATOR_H_
+
+#include "IAllocator.h"
+
+namespace IC
+{
+    /// A stack allocator which allocates from a buffer by moving the top of the stack
+    /// forward by the size of the allocation, and deallocates by moving it back again. 
+    /// Allocations must be deallocated in the reverse order to which they were allocated,
+    /// which is checked with an assert.
+    ///
+    /// A small header is stored before each allocation, containing the previous top of
+    /// the stack and the previous allocation, so any alignment padding is reclaimed when
+    /// the allocation is deallocated.
+    ///
+    /// A StackAllocator can be backed by other allocator types, from which the buffer
+    /// will be allocated, otherwise it's allocated from the free store.
+    ///
+    /// Note that this is not thread-safe and should not be accessed from multiple
+    /// threads at the same time.
+    ///
+    class StackAllocator final : public IAllocator
+    {
+    public:
+        /// Initialises a new StackAllocator with the given buffer size. The buffer will be 
+        /// allocated from the free store.
+        ///
+        /// @param bufferSize
+        ///     The size of the buffer.
+        /// 
+        StackAllocator(std::size_t bufferSize) noexcept;
+
+        /// Initialises a new StackAllocator with the given buffer size. The buffer will be
+        /// allocated from the given parent allocator.
+        ///
+        /// @param parentAllocator
+        ///     The allocator from which the buffer will be allocated.
+        /// @param bufferSize
+        ///     The size of the buffer.
+        /// 
+        StackAllocator(IAllocator& parentAllocator, std::size_t bufferSize) noexcept;
+
+        /// This thread-safe.
+        ///
+        /// @return The maximum allocation size from this allocator. This will always be 
+        /// the size of the buffer, less the size of an allocation header.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override;
+
+        /// This thread-safe.
+        ///
+        /// @return The size of the buffer. 
+        ///
+        std::size_t GetBufferSize() const noexcept { return m_bufferSize; }
+
+        /// @return The number of bytes which are free in the buffer, including space for
+        /// the header of the next allocation.
+        ///
+        std::size_t GetFreeSpace() const noexcept;
+
+        /// Allocates a new block of memory of the requested size from the top of the stack. 
+        /// If there is no space left in the buffer for the alloaction then this will assert.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Allocates a new block of memory of the requested size and alignment from the top 
+        /// of the stack. If there is no space left in the buffer for the alloaction then 
+        /// this will assert.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
+        /// Deallocates the given allocation, moving the top of the stack back to where it 
+        /// was before the allocation was made. This must be the most recent allocation
+        /// which has not yet been deallocated, otherwise this will assert.
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate.
+        ///
+        void Deallocate(void* pointer) noexcept override;
+
+        /// Attempts to resize the given allocation without moving it. This is only possible
+        /// for the allocation at the top of the stack, which can grow into the remaining free
+        /// space in the buffer, or shrink.
+        ///
+        /// @param pointer
+        ///     The allocation which should be resized.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return Whether or not the allocation was resized.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
+        /// Evaluates whether or not the given pointer was allocated from this stack 
+        /// allocator.
+        ///
+        /// @param pointer
+        ///        The pointer.
+        ///
+        /// @return Whether or not the pointer was allocated from this allocator.
+        ///
+        bool Contains(void* pointer) const noexcept;
+
+        ~StackAllocator() noexcept;
+
+    private:
+        /// The header stored immediately before each allocation.
+        ///
+        struct Header final
+        {
+            std::uint8_t* m_previousTop;
+            std::uint8_t* m_previousAllocation;
+        };
+
+        StackAllocator(StackAllocator&) = delete;
+        StackAllocator& operator=(StackAllocator&) = delete;
+        StackAllocator(StackAllocator&&) = delete;
+        StackAllocator& operator=(StackAllocator&&) = delete;
+
+        const std::size_t m_bufferSize;
+
+        IAllocator* m_parentAllocator = nullptr;
+
+        std::uint8_t* m_buffer = nullptr;
+        std::uint8_t* m_top = nullptr;
+        std::uint8_t* m_lastAllocation = nullptr;
+    };
+}
+
+#endif
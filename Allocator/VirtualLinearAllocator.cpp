@@ -0,0 +1,176 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "VirtualLinearAllocator.h"
+
+#include "../Utility/MemoryUtils.h"
+#include "../Utility/VirtualMemoryUtils.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    VirtualLinearAllocator::VirtualLinearAllocator(std::size_t reserveSize, std::size_t commitSize) noexcept
+        : m_reserveSize(MemoryUtils::Align(reserveSize, VirtualMemoryUtils::GetPageSize())), m_commitSize(MemoryUtils::Align(commitSize, VirtualMemoryUtils::GetPageSize()))
+    {
+        assert(m_reserveSize > 0);
+        assert(m_commitSize > 0);
+
+        m_buffer = reinterpret_cast<std::uint8_t*>(VirtualMemoryUtils::Reserve(m_reserveSize));
+        assert(m_buffer);
+
+        m_nextPointer = m_buffer;
+    }
+
+    //------------------------------------------------------------------------------
+    std::size_t VirtualLinearAllocator::GetFreeSpace() const noexcept
+    {
+        return m_reserveSize - MemoryUtils::GetPointerOffset(m_nextPointer, m_buffer);
+    }
+
+    //------------------------------------------------------------------------------
+    void* VirtualLinearAllocator::Allocate(std::size_t allocationSize) noexcept
+    {
+        return Allocate(allocationSize, sizeof(std::intptr_t));
+    }
+
+    //------------------------------------------------------------------------------
+    void* VirtualLinearAllocator::Allocate(std::size_t allocationSize, std::size_t alignment) noexcept
+    {
+        assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+        std::uint8_t* output = MemoryUtils::Align(m_nextPointer, alignment);
+        assert(MemoryUtils::GetPointerOffset(output, m_buffer) <= m_reserveSize);
+        assert(allocationSize <= m_reserveSize - MemoryUtils::GetPointerOffset(output, m_buffer));
+
+        auto nextPointer = std::min(MemoryUtils::Align(output + allocationSize, sizeof(std::intptr_t)), m_buffer + m_reserveSize);
+        CommitTo(nextPointer);
+
+        m_nextPointer = nextPointer;
+        m_lastAllocation = output;
+
+        ++m_activeAllocationCount;
+
+        return output;
+    }
+
+    //------------------------------------------------------------------------------
+    void VirtualLinearAllocator::Deallocate(void* pointer) noexcept
+    {
+        assert(Contains(pointer));
+
+        --m_activeAllocationCount;
+    }
+
+    //------------------------------------------------------------------------------
+    bool VirtualLinearAllocator::TryResizeInPlace(void* pointer, std::size_t newSize) noexcept
+    {
+        assert(Contains(pointer));
+
+        if (pointer != m_lastAllocation || newSize > m_reserveSize - MemoryUtils::GetPointerOffset(m_lastAllocation, m_buffer))
+        {
+            return false;
+        }
+
+        auto nextPointer = std::min(MemoryUtils::Align(m_lastAllocation + newSize, sizeof(std::intptr_t)), m_buffer + m_reserveSize);
+        CommitTo(nextPointer);
+
+        m_nextPointer = nextPointer;
+        return true;
+    }
+
+    //------------------------------------------------------------------------------
+    bool VirtualLinearAllocator::Contains(void* pointer) const noexcept
+    {
+        return (pointer >= m_buffer && pointer < m_buffer + m_reserveSize);
+    }
+
+    //------------------------------------------------------------------------------
+    void VirtualLinearAllocator::Reset() noexcept
+    {
+        assert(m_activeAllocationCount == 0);
+
+        m_nextPointer = m_buffer;
+        m_lastAllocation = nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    void VirtualLinearAllocator::ResetAndDiscard() noexcept
+    {
+        Reset();
+
+        if (m_committedSize > m_commitSize)
+        {
+            VirtualMemoryUtils::Discard(m_buffer + m_commitSize, m_committedSize - m_commitSize);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    VirtualLinearAllocator::Marker VirtualLinearAllocator::GetMarker() const noexcept
+    {
+        Marker marker;
+        marker.m_nextPointer = m_nextPointer;
+        marker.m_lastAllocation = m_lastAllocation;
+        marker.m_activeAllocationCount = m_activeAllocationCount;
+
+        return marker;
+    }
+
+    //------------------------------------------------------------------------------
+    void VirtualLinearAllocator::RewindTo(const Marker& marker) noexcept
+    {
+        assert(marker.m_nextPointer >= m_buffer && marker.m_nextPointer <= m_nextPointer);
+        assert(m_activeAllocationCount <= marker.m_activeAllocationCount);
+
+        m_nextPointer = marker.m_nextPointer;
+        m_lastAllocation = marker.m_lastAllocation;
+    }
+
+    //------------------------------------------------------------------------------
+    void VirtualLinearAllocator::CommitTo(std::uint8_t* end) noexcept
+    {
+        auto requiredSize = MemoryUtils::GetPointerOffset(end, m_buffer);
+        if (requiredSize <= m_committedSize)
+        {
+            return;
+        }
+
+        auto newCommittedSize = std::min(((requiredSize + m_commitSize - 1) / m_commitSize) * m_commitSize, m_reserveSize);
+        auto committed = VirtualMemoryUtils::Commit(m_buffer + m_committedSize, newCommittedSize - m_committedSize);
+        assert(committed);
+        (void)committed;
+
+        m_committedSize = newCommittedSize;
+    }
+
+    //------------------------------------------------------------------------------
+    VirtualLinearAllocator::~VirtualLinearAllocator() noexcept
+    {
+        Reset();
+
+        VirtualMemoryUtils::Release(m_buffer, m_reserveSize);
+        m_buffer = nullptr;
+    }
+}
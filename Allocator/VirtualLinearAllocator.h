@@ -0,0 +1,212 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef _ICMEMORY_ALLOCATOR_VIRTUALLINEARALLOCATOR_H_
+#define _ICMEMORY_ALLOCATOR_VIRTUALLINEARALLOCATOR_H_
+
+#include "IAllocator.h"
+
+namespace IC
+{
+    /// A linear allocator which allocates from a single contiguous range of reserved 
+    /// virtual address space. The range is reserved up front but is only committed as
+    /// the next allocation pointer moves through it, so the range can be far larger than
+    /// the memory which is actually used. Unlike PagedLinearAllocator, allocations are 
+    /// always contiguous and can be any size up to the size of the range.
+    ///
+    /// All allocations are 'deallocated' at the same time by resetting the allocation 
+    /// pointer back to the start of the range. Committed memory is kept for reuse, 
+    /// unless ResetAndDiscard() is used, which also returns the physical memory backing
+    /// everything beyond the first commit step to the operating system.
+    ///
+    /// As with LinearAllocator, a marker can be taken and the allocator later rewound to
+    /// it.
+    ///
+    /// The memory is always taken directly from the operating system, so this can't be
+    /// backed by another allocator.
+    ///
+    /// Note that this is not thread-safe and should not be accessed from multiple
+    /// threads at the same time.
+    ///
+    class VirtualLinearAllocator final : public IAllocator
+    {
+    public:
+        static constexpr std::size_t k_defaultCommitSize = 64 * 1024;
+
+        /// A position in the allocator which it can later be rewound to. This should be
+        /// treated as opaque.
+        ///
+        struct Marker final
+        {
+            std::uint8_t* m_nextPointer = nullptr;
+            std::uint8_t* m_lastAllocation = nullptr;
+            std::size_t m_activeAllocationCount = 0;
+        };
+
+        /// Initialises a new VirtualLinearAllocator, reserving the given amount of address 
+        /// space.
+        ///
+        /// @param reserveSize
+        ///     The size of the address range to reserve. This is rounded up to a multiple of
+        ///     the page size. Only address space is used, so this can be very large.
+        /// @param commitSize
+        ///     Optional. The minimum amount of memory committed at a time. This is rounded up
+        ///     to a multiple of the page size. Defaults to k_defaultCommitSize.
+        /// 
+        VirtualLinearAllocator(std::size_t reserveSize, std::size_t commitSize = k_defaultCommitSize) noexcept;
+
+        /// This thread-safe.
+        ///
+        /// @return The maximum allocation size from this allocator. This will always be 
+        /// the size of the reserved range.
+        ///
+        std::size_t GetMaxAllocationSize() const noexcept override { return GetReserveSize(); }
+
+        /// This thread-safe.
+        ///
+        /// @return The size of the reserved range.
+        ///
+        std::size_t GetReserveSize() const noexcept { return m_reserveSize; }
+
+        /// @return The amount of memory which has been committed.
+        ///
+        std::size_t GetCommittedSize() const noexcept { return m_committedSize; }
+
+        /// @return The number of bytes which are free in the reserved range. 
+        ///
+        std::size_t GetFreeSpace() const noexcept;
+
+        /// Allocates a new block of memory of the requested size. More memory is committed
+        /// if needed. If there is no space left in the reserved range for the allocation 
+        /// then this will assert.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize) noexcept override;
+
+        /// Allocates a new block of memory of the requested size and alignment. The next 
+        /// allocation pointer is simply moved forward to the required alignment. More 
+        /// memory is committed if needed. If there is no space left in the reserved range
+        /// for the allocation then this will assert.
+        ///
+        /// @param allocationSize
+        ///     The size of the allocation.
+        /// @param alignment
+        ///     The alignment of the allocation. Must be a power of two.
+        ///
+        /// @return The allocated memory.
+        ///
+        void* Allocate(std::size_t allocationSize, std::size_t alignment) noexcept override;
+
+        /// Decriments the allocation count. This is checked when resetting to ensure that all previously
+        /// allocated memory has been deallocated.
+        ///
+        /// @param pointer
+        ///     The pointer to deallocate.
+        ///
+        void Deallocate(void* pointer) noexcept override;
+
+        /// Attempts to resize the given allocation without moving it. This is only possible
+        /// for the most recent allocation, which can grow into the remainder of the reserved
+        /// range, or shrink.
+        ///
+        /// @param pointer
+        ///     The allocation which should be resized.
+        /// @param newSize
+        ///     The requested size of the allocation.
+        ///
+        /// @return Whether or not the allocation was resized.
+        ///
+        bool TryResizeInPlace(void* pointer, std::size_t newSize) noexcept override;
+
+        /// Evaluates whether or not the given pointer was allocated from this linear
+        /// allocator.
+        ///
+        /// @param pointer
+        ///        The pointer.
+        ///
+        /// @return Whether or not the pointer was allocated from this allocator.
+        ///
+        bool Contains(void* pointer) const noexcept;
+
+        /// Resets the allocator, allowing all previously allocated memory to be reused. 
+        /// Deallocate() must have been called for all allocated blocks prior to reset() 
+        /// being called. The committed memory is kept.
+        /// 
+        void Reset() noexcept;
+
+        /// Resets the allocator, allowing all previously allocated memory to be reused. 
+        /// Deallocate() must have been called for all allocated blocks prior to reset() 
+        /// being called. The physical memory backing all committed memory after the first
+        /// commit step is discarded. It remains committed, so will be faulted back in 
+        /// without a system call when it is next used.
+        /// 
+        void ResetAndDiscard() noexcept;
+
+        /// @return A marker for the current position in the allocator.
+        ///
+        Marker GetMarker() const noexcept;
+
+        /// Rewinds the allocator to the given marker, allowing all memory allocated since the
+        /// marker was taken to be reused. Committed memory is kept. Deallocate() must have been
+        /// called for all blocks allocated since the marker was taken. The allocator must not
+        /// have been reset or rewound to an earlier marker since the marker was taken.
+        ///
+        /// @param marker
+        ///     The marker to rewind to.
+        ///
+        void RewindTo(const Marker& marker) noexcept;
+
+        ~VirtualLinearAllocator() noexcept;
+
+    private:
+        VirtualLinearAllocator(VirtualLinearAllocator&) = delete;
+        VirtualLinearAllocator& operator=(VirtualLinearAllocator&) = delete;
+        VirtualLinearAllocator(VirtualLinearAllocator&&) = delete;
+        VirtualLinearAllocator& operator=(VirtualLinearAllocator&&) = delete;
+
+        /// Commits memory, if needed, such that everything before the given pointer is
+        /// committed. Memory is committed in multiples of the commit size.
+        ///
+        /// @param end
+        ///     The end of the memory which must be committed. Must be within the reserved
+        ///     range.
+        ///
+        void CommitTo(std::uint8_t* end) noexcept;
+
+        const std::size_t m_reserveSize;
+        const std::size_t m_commitSize;
+
+        std::uint8_t* m_buffer = nullptr;
+        std::uint8_t* m_nextPointer = nullptr;
+        std::uint8_t* m_lastAllocation = nullptr;
+        std::size_t m_committedSize = 0;
+
+        std::size_t m_activeAllocationCount = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,189 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORY_CONTAINER_INTRUSIVEPTR_H_
+#define _ICMEMORY_CONTAINER_INTRUSIVEPTR_H_
+
+#include "../Allocator/IAllocator.h"
+
+#include <atomic>
+#include <cstddef>
+
+namespace IC
+{
+    /// A reference count policy for IntrusivePtr which uses an atomic count, so pointers
+    /// to the same object can be copied and destroyed on multiple threads at the same
+    /// time.
+    ///
+    class AtomicRefCount final
+    {
+    public:
+        /// Increments the reference count.
+        ///
+        void Increment() noexcept;
+
+        /// Decrements the reference count.
+        ///
+        /// @return Whether or not this released the last reference.
+        ///
+        bool Decrement() noexcept;
+
+        /// @return The current reference count.
+        ///
+        std::size_t Get() const noexcept;
+
+    private:
+        std::atomic<std::size_t> m_count{ 1 };
+    };
+
+    /// A reference count policy for IntrusivePtr which uses a plain count. This is cheaper
+    /// than AtomicRefCount, but all pointers to the same object must only be accessed from
+    /// a single thread at a time.
+    ///
+    class NonAtomicRefCount final
+    {
+    public:
+        /// Increments the reference count.
+        ///
+        void Increment() noexcept;
+
+        /// Decrements the reference count.
+        ///
+        /// @return Whether or not this released the last reference.
+        ///
+        bool Decrement() noexcept;
+
+        /// @return The current reference count.
+        ///
+        std::size_t Get() const noexcept;
+
+    private:
+        std::size_t m_count = 1;
+    };
+
+    /// A reference counted pointer which stores the reference count and the allocator
+    /// the object was allocated from in a small header immediately before the object.
+    /// The object and header are a single allocation, and the pointer itself is the size
+    /// of a single pointer. Unlike SharedPtr there are no weak references.
+    ///
+    /// Instances should be created with MakeIntrusive(). The allocation can come from any
+    /// of the allocators, including a BlockAllocator with a block size of at least
+    /// GetAllocationSize().
+    ///
+    /// Whether or not copies of the pointer can be used on multiple threads depends on
+    /// the reference count policy; see AtomicRefCount and NonAtomicRefCount.
+    ///
+    template <typename TType, typename TRefCountPolicy = AtomicRefCount> class IntrusivePtr final
+    {
+    public:
+        /// @return The size of the allocation required for the object and its header.
+        ///
+        static constexpr std::size_t GetAllocationSize() noexcept;
+
+        /// @return The alignment of the allocation required for the object and its header.
+        ///
+        static constexpr std::size_t GetAllocationAlignment() noexcept;
+
+        IntrusivePtr() = default;
+        IntrusivePtr(std::nullptr_t) noexcept;
+        IntrusivePtr(const IntrusivePtr& toCopy) noexcept;
+        IntrusivePtr(IntrusivePtr&& toMove) noexcept;
+        IntrusivePtr& operator=(const IntrusivePtr& toCopy) noexcept;
+        IntrusivePtr& operator=(IntrusivePtr&& toMove) noexcept;
+
+        /// @return The object, or null if this is empty.
+        ///
+        TType* get() const noexcept { return m_object; }
+
+        /// @return The number of pointers which currently reference the object, or zero
+        /// if this is empty.
+        ///
+        std::size_t use_count() const noexcept;
+
+        /// Releases the reference to the object, leaving this empty. If this was the last
+        /// reference the object is destroyed and its memory returned to its allocator.
+        ///
+        void reset() noexcept;
+
+        TType& operator*() const noexcept { return *m_object; }
+        TType* operator->() const noexcept { return m_object; }
+        explicit operator bool() const noexcept { return m_object != nullptr; }
+
+        ~IntrusivePtr() noexcept;
+
+    private:
+        template <typename TOtherType, typename TOtherRefCountPolicy, typename... TConstructorArgs> 
+        friend IntrusivePtr<TOtherType, TOtherRefCountPolicy> MakeIntrusive(IAllocator& allocator, TConstructorArgs&&... constructorArgs) noexcept;
+
+        /// The header which is stored immediately before the object.
+        ///
+        struct Header final
+        {
+            TRefCountPolicy m_refCount;
+            IAllocator* m_allocator = nullptr;
+        };
+
+        /// The offset of the object from the start of the allocation. This leaves room
+        /// for the header, while keeping the object correctly aligned.
+        ///
+        static constexpr std::size_t k_objectOffset = ((sizeof(Header) + alignof(TType) - 1) / alignof(TType)) * alignof(TType);
+
+        /// Creates a new pointer which takes ownership of the initial reference to the
+        /// given object.
+        ///
+        /// @param object
+        ///     The object, which must have been allocated with a header.
+        ///
+        explicit IntrusivePtr(TType* object) noexcept;
+
+        /// @return The header for the object. This must not be empty.
+        ///
+        Header* GetHeader() const noexcept;
+
+        TType* m_object = nullptr;
+    };
+
+    /// Allocates a new intrusive pointer from the given allocator with the given 
+    /// constructor parameters. This follows the make_* convention set in the 
+    /// standard library. The object and its header are a single allocation.
+    ///
+    /// @param allocator
+    ///     The allocator from which to allocate the requested type. This must outlive
+    ///     the object.
+    /// @param constructorArgs
+    ///     The arguments for the constructor if appropriate.
+    ///
+    /// @return An intrusive pointer to the allocated instance, or an empty pointer if the
+    /// allocation failed.
+    ///
+    template <typename TType, typename TRefCountPolicy = AtomicRefCount, typename... TConstructorArgs> 
+    IntrusivePtr<TType, TRefCountPolicy> MakeIntrusive(IAllocator& allocator, TConstructorArgs&&... constructorArgs) noexcept;
+
+    template <typename TType, typename TRefCountPolicy> bool operator==(const IntrusivePtr<TType, TRefCountPolicy>& a, const IntrusivePtr<TType, TRefCountPolicy>& b) noexcept;
+    template <typename TType, typename TRefCountPolicy> bool operator!=(const IntrusivePtr<TType, TRefCountPolicy>& a, const IntrusivePtr<TType, TRefCountPolicy>& b) noexcept;
+    template <typename TType, typename TRefCountPolicy> bool operator==(const IntrusivePtr<TType, TRefCountPolicy>& a, std::nullptr_t) noexcept;
+    template <typename TType, typename TRefCountPolicy> bool operator!=(const IntrusivePtr<TType, TRefCountPolicy>& a, std::nullptr_t) noexcept;
+}
+
+#include "IntrusivePtrImpl.h"
+
+#endif
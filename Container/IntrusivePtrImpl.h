@@ -0,0 +1,216 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORY_CONTAINER_INTRUSIVEPTRIMPL_H_
+#define _ICMEMORY_CONTAINER_INTRUSIVEPTRIMPL_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace IC
+{
+    //------------------------------------------------------------------------------
+    inline void AtomicRefCount::Increment() noexcept
+    {
+        m_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    inline bool AtomicRefCount::Decrement() noexcept
+    {
+        return m_count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    //------------------------------------------------------------------------------
+    inline std::size_t AtomicRefCount::Get() const noexcept
+    {
+        return m_count.load(std::memory_order_relaxed);
+    }
+
+    //------------------------------------------------------------------------------
+    inline void NonAtomicRefCount::Increment() noexcept
+    {
+        ++m_count;
+    }
+
+    //------------------------------------------------------------------------------
+    inline bool NonAtomicRefCount::Decrement() noexcept
+    {
+        return --m_count == 0;
+    }
+
+    //------------------------------------------------------------------------------
+    inline std::size_t NonAtomicRefCount::Get() const noexcept
+    {
+        return m_count;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> constexpr std::size_t IntrusivePtr<TType, TRefCountPolicy>::k_objectOffset;
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> constexpr std::size_t IntrusivePtr<TType, TRefCountPolicy>::GetAllocationSize() noexcept
+    {
+        return k_objectOffset + sizeof(TType);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> constexpr std::size_t IntrusivePtr<TType, TRefCountPolicy>::GetAllocationAlignment() noexcept
+    {
+        return alignof(TType) > alignof(Header) ? alignof(TType) : alignof(Header);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> IntrusivePtr<TType, TRefCountPolicy>::IntrusivePtr(std::nullptr_t) noexcept
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> IntrusivePtr<TType, TRefCountPolicy>::IntrusivePtr(const IntrusivePtr& toCopy) noexcept
+        : m_object(toCopy.m_object)
+    {
+        if (m_object)
+        {
+            GetHeader()->m_refCount.Increment();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> IntrusivePtr<TType, TRefCountPolicy>::IntrusivePtr(IntrusivePtr&& toMove) noexcept
+        : m_object(toMove.m_object)
+    {
+        toMove.m_object = nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> IntrusivePtr<TType, TRefCountPolicy>& IntrusivePtr<TType, TRefCountPolicy>::operator=(const IntrusivePtr& toCopy) noexcept
+    {
+        IntrusivePtr copy(toCopy);
+        std::swap(m_object, copy.m_object);
+
+        return *this;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> IntrusivePtr<TType, TRefCountPolicy>& IntrusivePtr<TType, TRefCountPolicy>::operator=(IntrusivePtr&& toMove) noexcept
+    {
+        IntrusivePtr moved(std::move(toMove));
+        std::swap(m_object, moved.m_object);
+
+        return *this;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> std::size_t IntrusivePtr<TType, TRefCountPolicy>::use_count() const noexcept
+    {
+        return m_object ? GetHeader()->m_refCount.Get() : 0;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> void IntrusivePtr<TType, TRefCountPolicy>::reset() noexcept
+    {
+        if (!m_object)
+        {
+            return;
+        }
+
+        auto header = GetHeader();
+        if (header->m_refCount.Decrement())
+        {
+            auto allocator = header->m_allocator;
+
+            m_object->~TType();
+            header->~Header();
+            allocator->Deallocate(reinterpret_cast<void*>(header), GetAllocationSize());
+        }
+
+        m_object = nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> IntrusivePtr<TType, TRefCountPolicy>::~IntrusivePtr() noexcept
+    {
+        reset();
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> IntrusivePtr<TType, TRefCountPolicy>::IntrusivePtr(TType* object) noexcept
+        : m_object(object)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> typename IntrusivePtr<TType, TRefCountPolicy>::Header* IntrusivePtr<TType, TRefCountPolicy>::GetHeader() const noexcept
+    {
+        assert(m_object);
+
+        return reinterpret_cast<Header*>(reinterpret_cast<std::uint8_t*>(m_object) - k_objectOffset);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy, typename... TConstructorArgs> 
+    IntrusivePtr<TType, TRefCountPolicy> MakeIntrusive(IAllocator& allocator, TConstructorArgs&&... constructorArgs) noexcept
+    {
+        using Pointer = IntrusivePtr<TType, TRefCountPolicy>;
+
+        void* memory = allocator.Allocate(Pointer::GetAllocationSize(), Pointer::GetAllocationAlignment());
+        if (!memory)
+        {
+            return Pointer();
+        }
+
+        auto header = new (memory) typename Pointer::Header();
+        header->m_allocator = &allocator;
+
+        TType* object = new (reinterpret_cast<std::uint8_t*>(memory) + Pointer::k_objectOffset) TType(std::forward<TConstructorArgs>(constructorArgs)...);
+        return Pointer(object);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> bool operator==(const IntrusivePtr<TType, TRefCountPolicy>& a, const IntrusivePtr<TType, TRefCountPolicy>& b) noexcept
+    {
+        return a.get() == b.get();
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> bool operator!=(const IntrusivePtr<TType, TRefCountPolicy>& a, const IntrusivePtr<TType, TRefCountPolicy>& b) noexcept
+    {
+        return a.get() != b.get();
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> bool operator==(const IntrusivePtr<TType, TRefCountPolicy>& a, std::nullptr_t) noexcept
+    {
+        return !a;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType, typename TRefCountPolicy> bool operator!=(const IntrusivePtr<TType, TRefCountPolicy>& a, std::nullptr_t) noexcept
+    {
+        return static_cast<bool>(a);
+    }
+}
+
+#endif
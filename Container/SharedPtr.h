@@ -25,6 +25,7 @@
 #ifndef _ICMEMORY_CONTAINER_SHAREDPTR_H_
 #define _ICMEMORY_CONTAINER_SHAREDPTR_H_
 
+#include "../Allocator/AllocatorWrapper.h"
 #include "../Allocator/IAllocator.h"
 
 #include <memory>
@@ -35,7 +36,8 @@ namespace IC
 
     /// Allocates a new shared pointer from the given Allocator with the given 
     /// constructor parameters. This follows the make_* convention set in the 
-    /// standard library.
+    /// standard library. The object and its reference counts are stored in a
+    /// single allocation from the given allocator.
     ///
     /// @param allocator
     ///     The allocator from which to allocate the requested type.
@@ -30,7 +30,7 @@ namespace IC
     //------------------------------------------------------------------------------
     template <typename TType, typename... TConstructorArgs> SharedPtr<TType> MakeShared(IAllocator& allocator, TConstructorArgs&&... constructorArgs) noexcept
     {
-        return MakeUnique<TType>(allocator, std::forward<TConstructorArgs>(constructorArgs)...);
+        return std::allocate_shared<TType>(AllocatorWrapper<TType>(&allocator), std::forward<TConstructorArgs>(constructorArgs)...);
     }
 }
 
@@ -27,12 +27,73 @@
 
 #include "../Allocator/IAllocator.h"
 
-#include <functional>
+#include <algorithm>
+#include <cassert>
 #include <memory>
 
 namespace IC
 {
-    template <typename TType> using UniquePtr = std::unique_ptr<TType, std::function<void(typename std::remove_all_extents<TType>::type*)>>;
+    /// The deleter used by UniquePtr. This destroys the object and returns its memory
+    /// to the allocator it was allocated from. It only stores a pointer to the allocator,
+    /// so a UniquePtr is the size of two pointers and creating one never allocates.
+    ///
+    /// A default constructed deleter has no allocator and must not be invoked.
+    ///
+    template <typename TType> class UniquePtrDeleter final
+    {
+    public:
+        UniquePtrDeleter() = default;
+
+        /// Creates a new deleter which returns memory to the given allocator.
+        ///
+        /// @param allocator
+        ///     The allocator the object was allocated from.
+        ///
+        UniquePtrDeleter(IAllocator& allocator) noexcept;
+
+        /// Destroys the given object and deallocates its memory.
+        ///
+        /// @param object
+        ///     The object which should be deleted.
+        ///
+        void operator()(TType* object) const noexcept;
+
+    private:
+        IAllocator* m_allocator = nullptr;
+    };
+
+    /// The deleter used by UniquePtr for arrays. As well as the allocator this stores the
+    /// number of elements in the array, so that each can be destroyed.
+    ///
+    /// A default constructed deleter has no allocator and must not be invoked.
+    ///
+    template <typename TType> class UniquePtrDeleter<TType[]> final
+    {
+    public:
+        UniquePtrDeleter() = default;
+
+        /// Creates a new deleter which returns memory to the given allocator.
+        ///
+        /// @param allocator
+        ///     The allocator the array was allocated from.
+        /// @param size
+        ///     The number of elements in the array.
+        ///
+        UniquePtrDeleter(IAllocator& allocator, std::size_t size) noexcept;
+
+        /// Destroys each element in the given array and deallocates its memory.
+        ///
+        /// @param array
+        ///     The array which should be deleted.
+        ///
+        void operator()(TType* array) const noexcept;
+
+    private:
+        IAllocator* m_allocator = nullptr;
+        std::size_t m_size = 0;
+    };
+
+    template <typename TType> using UniquePtr = std::unique_ptr<TType, UniquePtrDeleter<TType>>;
 
     /// Allocates a new unique pointer from the given Allocator with the given 
     /// constructor parameters. This follows the make_* convention set in the 
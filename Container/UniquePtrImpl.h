@@ -27,22 +27,55 @@
 
 namespace IC
 {
+    //------------------------------------------------------------------------------
+    template <typename TType> UniquePtrDeleter<TType>::UniquePtrDeleter(IAllocator& allocator) noexcept
+        : m_allocator(&allocator)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType> void UniquePtrDeleter<TType>::operator()(TType* object) const noexcept
+    {
+        assert(m_allocator);
+
+        object->~TType();
+        m_allocator->Deallocate(reinterpret_cast<void*>(object), sizeof(TType));
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType> UniquePtrDeleter<TType[]>::UniquePtrDeleter(IAllocator& allocator, std::size_t size) noexcept
+        : m_allocator(&allocator), m_size(size)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TType> void UniquePtrDeleter<TType[]>::operator()(TType* array) const noexcept
+    {
+        assert(m_allocator);
+
+        if (!std::is_fundamental<TType>::value)
+        {
+            for (std::size_t i = 0; i < m_size; ++i)
+            {
+                (array + i)->~TType();
+            }
+        }
+
+        m_allocator->Deallocate(reinterpret_cast<void*>(array), std::max(sizeof(TType) * m_size, alignof(TType)));
+    }
+
     //------------------------------------------------------------------------------
     template <typename TType, typename... TConstructorArgs> UniquePtr<TType> MakeUnique(IAllocator& allocator, TConstructorArgs&&... constructorArgs) noexcept
     {
-        void* memory = allocator.Allocate(sizeof(TType));
+        void* memory = allocator.Allocate(sizeof(TType), alignof(TType));
         TType* object = new (memory) TType(std::forward<TConstructorArgs>(constructorArgs)...);
-        return UniquePtr<TType>(object, [&allocator](TType* object) noexcept -> void
-        {
-            object->~TType();
-            allocator.Deallocate(reinterpret_cast<void*>(object));
-        });
+        return UniquePtr<TType>(object, UniquePtrDeleter<TType>(allocator));
     }
 
     //------------------------------------------------------------------------------
     template <typename TType> UniquePtr<TType[]> MakeUniqueArray(IAllocator& allocator, std::size_t size) noexcept
     {
-        auto array = reinterpret_cast<TType*>(allocator.Allocate(sizeof(TType) * size));
+        auto array = reinterpret_cast<TType*>(allocator.Allocate(sizeof(TType) * size, alignof(TType)));
         if (!std::is_fundamental<TType>::value)
         {
             for (std::size_t i = 0; i < size; ++i)
@@ -51,18 +84,7 @@ namespace IC
             }
         }
 
-        return UniquePtr<TType[]>(array, [&allocator, size](TType* array) noexcept -> void
-        {
-            if (!std::is_fundamental<TType>::value)
-            {
-                for (std::size_t i = 0; i < size; ++i)
-                {
-                    (array + i)->~TType();
-                }
-            }
-
-            allocator.Deallocate(reinterpret_cast<void*>(array));
-        });
+        return UniquePtr<TType[]>(array, UniquePtrDeleter<TType[]>(allocator, size));
     }
 }
 
@@ -31,15 +31,27 @@ namespace IC
     template <typename TValueType> class AllocatorWrapper;
     class BlockAllocator;
     class BuddyAllocator;
+    class BuddyAllocatorCache;
+    class ConcurrentBlockAllocator;
+    class ConcurrentLinearAllocator;
+    class ConcurrentPagedLinearAllocator;
+    class DoubleEndedStackAllocator;
     class IAllocator;
     class LinearAllocator;
+    class MultiBufferedAllocator;
+    class PageAllocator;
     class PagedBlockAllocator;
     class PagedLinearAllocator;
+    template <typename TLinearAllocator> class ScopedLinearAllocation;
     class SmallObjectAllocator;
+    class StackAllocator;
+    class VirtualLinearAllocator;
 
     // Pool
-    template <typename TObject> class ObjectPool;
+    template <typename TObject> class HandlePool;
+    template <typename TObject, typename TBlockAllocator = BlockAllocator> class ObjectPool;
     template <typename TObject> class PagedObjectPool;
+    template <typename... TFields> class SoAPool;
 }
 
 #endif
\ No newline at end of file
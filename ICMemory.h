@@ -27,11 +27,22 @@
 
 #include "Allocator/BlockAllocator.h"
 #include "Allocator/BuddyAllocator.h"
+#include "Allocator/BuddyAllocatorCache.h"
+#include "Allocator/ConcurrentBlockAllocator.h"
+#include "Allocator/ConcurrentLinearAllocator.h"
+#include "Allocator/ConcurrentPagedLinearAllocator.h"
+#include "Allocator/DoubleEndedStackAllocator.h"
 #include "Allocator/LinearAllocator.h"
+#include "Allocator/MultiBufferedAllocator.h"
+#include "Allocator/PageAllocator.h"
 #include "Allocator/PagedBlockAllocator.h"
 #include "Allocator/PagedLinearAllocator.h"
+#include "Allocator/ScopedLinearAllocation.h"
 #include "Allocator/SmallObjectAllocator.h"
+#include "Allocator/StackAllocator.h"
+#include "Allocator/VirtualLinearAllocator.h"
 #include "Container/Deque.h"
+#include "Container/IntrusivePtr.h"
 #include "Container/Queue.h"
 #include "Container/SharedPtr.h"
 #include "Container/String.h"
@@ -40,7 +51,9 @@
 #include "Container/UnorderedSet.h"
 #include "Container/UnorderedMap.h"
 #include "Container/Vector.h"
+#include "Pool/HandlePool.h"
 #include "Pool/ObjectPool.h"
 #include "Pool/PagedObjectPool.h"
+#include "Pool/SoAPool.h"
 
 #endif
\ No newline at end of file
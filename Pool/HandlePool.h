@@ -0,0 +1,215 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORY_POOL_HANDLEPOOL_H_
+#define _ICMEMORY_POOL_HANDLEPOOL_H_
+
+#include "../Allocator/BlockAllocator.h"
+#include "../Utility/MemoryUtils.h"
+
+#include <cstdint>
+
+namespace IC
+{
+    /// A fixed size object pool which refers to objects using 32-bit handles rather
+    /// than pointers. Each handle contains the index of the object in the pool and the
+    /// generation of that slot when the object was created. The generation is incremented
+    /// every time an object is destroyed, so looking up a handle to a destroyed object
+    /// safely returns null, rather than a dangling pointer.
+    ///
+    /// Handles use 22 bits for the index and 10 bits for the generation, so a pool can
+    /// contain up to k_maxObjects objects, and a stale handle is only mistaken for a live
+    /// one if its slot has been reused a multiple of 1024 times.
+    ///
+    /// The pool owns its objects; any which have not been destroyed are destroyed along
+    /// with the pool. Live objects are also tracked in a dense list, so they can be
+    /// iterated over without visiting free slots.
+    ///
+    /// The pool can be backed by any of the allocators.
+    ///
+    /// This is not thread-safe and should not be accessed from multiple threads at the
+    /// same time.
+    ///
+    template <typename TObject> class HandlePool final
+    {
+    public:
+        /// A handle to an object in a HandlePool. A default constructed handle is invalid
+        /// and never refers to an object.
+        ///
+        struct Handle final
+        {
+            std::uint32_t m_value = 0xffffffff;
+
+            bool operator==(const Handle& other) const noexcept { return m_value == other.m_value; }
+            bool operator!=(const Handle& other) const noexcept { return m_value != other.m_value; }
+        };
+
+        static constexpr std::size_t k_numIndexBits = 22;
+        static constexpr std::size_t k_maxObjects = (std::size_t(1) << k_numIndexBits) - 1;
+
+        /// Creates a new handle pool containing the given number of objects. The memory
+        /// used for the pool is allocated from the free store.
+        ///
+        /// @param numObjects
+        ///        The number of objects in the pool. Must be no more than k_maxObjects.
+        ///
+        HandlePool(std::size_t numObjects) noexcept;
+
+        /// Creates a new handle pool containing the given number of objects. The memory
+        /// used for the pool is allocated from the given allocator.
+        ///
+        /// @param allocator
+        ///        The allocator from which to allocate the pool memory.
+        /// @param numObjects
+        ///        The number of objects in the pool. Must be no more than k_maxObjects.
+        ///
+        HandlePool(IAllocator& allocator, std::size_t numObjects) noexcept;
+
+        /// This is thread safe.
+        ///
+        /// @return The number of objects in the pool.
+        ///
+        std::size_t GetNumObjects() const noexcept { return m_numObjects; }
+
+        /// @return The number of objects in the pool which are allocated.
+        ///
+        std::size_t GetNumAllocatedObjects() const noexcept { return m_numLiveObjects; }
+
+        /// @return The number of objects in the pool which are not yet allocated.
+        ///
+        std::size_t GetNumFreeObjects() const noexcept { return m_numObjects - m_numLiveObjects; }
+
+        /// Creates a new object in the pool. If there are no free objects left in the
+        /// pool then this will assert.
+        ///
+        ///  @param constructorArgs
+        ///        The arguments for the constructor if appropriate.
+        ///
+        /// @return A handle to the newly constructed object.
+        ///
+        template <typename... TConstructorArgs> Handle Create(TConstructorArgs&&... constructorArgs) noexcept;
+
+        /// Destroys the object referred to by the given handle. The handle, and any copies
+        /// of it, will no longer refer to an object. If the handle does not refer to a live
+        /// object this will assert.
+        ///
+        /// @param handle
+        ///        The handle to the object which should be destroyed.
+        ///
+        void Destroy(Handle handle) noexcept;
+
+        /// @param handle
+        ///        The handle.
+        ///
+        /// @return Whether or not the handle refers to a live object. This is O(1).
+        ///
+        bool IsValid(Handle handle) const noexcept;
+
+        /// @param handle
+        ///        The handle.
+        ///
+        /// @return The object referred to by the given handle, or null if the handle does
+        /// not refer to a live object. This is O(1).
+        ///
+        TObject* Get(Handle handle) const noexcept;
+
+        /// Calls the given function for each live object in the pool. Objects are visited
+        /// in the order of the dense list, not in address order. Objects must not be
+        /// created or destroyed while iterating.
+        ///
+        /// @param function
+        ///        The function to call, which takes the handle and a reference to the
+        ///        object.
+        ///
+        template <typename TFunction> void ForEach(TFunction&& function) noexcept;
+
+        ~HandlePool() noexcept;
+
+    private:
+        static constexpr std::uint32_t k_indexMask = (std::uint32_t(1) << k_numIndexBits) - 1;
+        static constexpr std::uint32_t k_generationMask = 0xffffffff >> k_numIndexBits;
+
+        /// Information on each slot in the pool.
+        ///
+        /// m_generation:  The current generation of the slot.
+        /// m_denseIndex:  The position of the slot in the dense list, if it is live.
+        ///
+        struct Slot final
+        {
+            std::uint32_t m_generation = 0;
+            std::uint32_t m_denseIndex = 0;
+        };
+
+        HandlePool(HandlePool&) = delete;
+        HandlePool& operator=(HandlePool&) = delete;
+        HandlePool(HandlePool&&) = delete;
+        HandlePool& operator=(HandlePool&&) = delete;
+
+        /// @param numObjects
+        ///        The number of objects in the pool.
+        ///
+        /// @return The size of the buffer required for the block allocator, the slots and
+        /// the dense list.
+        ///
+        static std::size_t CalcBufferSize(std::size_t numObjects) noexcept;
+
+        /// Initialises the slots and dense list which follow the objects in the buffer.
+        ///
+        void InitSlots() noexcept;
+
+        /// @param index
+        ///        The index of the slot.
+        ///
+        /// @return The object in the slot with the given index.
+        ///
+        TObject* GetObject(std::uint32_t index) const noexcept;
+
+        /// @param index
+        ///        The index of the slot.
+        ///
+        /// @return A handle to the current generation of the slot.
+        ///
+        Handle MakeHandle(std::uint32_t index) const noexcept;
+
+        /// @param handle
+        ///        The handle.
+        ///
+        /// @return The index of the slot referred to by the handle if it refers to a live
+        /// object, otherwise k_indexMask.
+        ///
+        std::uint32_t GetLiveIndex(Handle handle) const noexcept;
+
+        const std::size_t m_numObjects;
+
+        IAllocator* m_parentAllocator = nullptr;
+        std::uint8_t* m_buffer = nullptr;
+        Slot* m_slots = nullptr;
+        std::uint32_t* m_denseList = nullptr;
+        std::size_t m_numLiveObjects = 0;
+
+        BlockAllocator m_blockAllocator;
+    };
+}
+
+#include "HandlePoolImpl.h"
+
+#endif
@@ -0,0 +1,184 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORY_POOL_HANDLEPOOLIMPL_H_
+#define _ICMEMORY_POOL_HANDLEPOOLIMPL_H_
+
+#include <new>
+#include <utility>
+
+namespace IC
+{
+    template <typename TObject> constexpr std::size_t HandlePool<TObject>::k_numIndexBits;
+    template <typename TObject> constexpr std::size_t HandlePool<TObject>::k_maxObjects;
+    template <typename TObject> constexpr std::uint32_t HandlePool<TObject>::k_indexMask;
+    template <typename TObject> constexpr std::uint32_t HandlePool<TObject>::k_generationMask;
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> HandlePool<TObject>::HandlePool(std::size_t numObjects) noexcept
+        : m_numObjects(numObjects), 
+        m_buffer(reinterpret_cast<std::uint8_t*>(MemoryUtils::AllocateAligned(CalcBufferSize(numObjects), BlockAllocator::CalcBufferAlignment(MemoryUtils::GetBlockSize<TObject>())))),
+        m_blockAllocator(m_buffer, MemoryUtils::GetBlockSize<TObject>(), numObjects)
+    {
+        assert(numObjects <= k_maxObjects);
+
+        InitSlots();
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> HandlePool<TObject>::HandlePool(IAllocator& allocator, std::size_t numObjects) noexcept
+        : m_numObjects(numObjects), m_parentAllocator(&allocator),
+        m_buffer(reinterpret_cast<std::uint8_t*>(allocator.Allocate(CalcBufferSize(numObjects), BlockAllocator::CalcBufferAlignment(MemoryUtils::GetBlockSize<TObject>())))),
+        m_blockAllocator(m_buffer, MemoryUtils::GetBlockSize<TObject>(), numObjects)
+    {
+        assert(numObjects <= k_maxObjects);
+
+        InitSlots();
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> template <typename... TConstructorArgs> typename HandlePool<TObject>::Handle HandlePool<TObject>::Create(TConstructorArgs&&... constructorArgs) noexcept
+    {
+        void* memory = m_blockAllocator.Allocate(sizeof(TObject), alignof(TObject));
+        new (memory) TObject(std::forward<TConstructorArgs>(constructorArgs)...);
+
+        auto index = static_cast<std::uint32_t>(MemoryUtils::GetPointerOffset(memory, m_buffer) / MemoryUtils::GetBlockSize<TObject>());
+        m_slots[index].m_denseIndex = static_cast<std::uint32_t>(m_numLiveObjects);
+        m_denseList[m_numLiveObjects++] = index;
+
+        return MakeHandle(index);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> void HandlePool<TObject>::Destroy(Handle handle) noexcept
+    {
+        auto index = GetLiveIndex(handle);
+        assert(index != k_indexMask);
+
+        auto object = GetObject(index);
+        object->~TObject();
+        m_blockAllocator.Deallocate(object);
+
+        auto& slot = m_slots[index];
+        slot.m_generation = (slot.m_generation + 1) & k_generationMask;
+
+        auto lastIndex = m_denseList[--m_numLiveObjects];
+        m_denseList[slot.m_denseIndex] = lastIndex;
+        m_slots[lastIndex].m_denseIndex = slot.m_denseIndex;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> bool HandlePool<TObject>::IsValid(Handle handle) const noexcept
+    {
+        return GetLiveIndex(handle) != k_indexMask;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> TObject* HandlePool<TObject>::Get(Handle handle) const noexcept
+    {
+        auto index = GetLiveIndex(handle);
+        return index != k_indexMask ? GetObject(index) : nullptr;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> template <typename TFunction> void HandlePool<TObject>::ForEach(TFunction&& function) noexcept
+    {
+        for (std::size_t i = 0; i < m_numLiveObjects; ++i)
+        {
+            auto index = m_denseList[i];
+            function(MakeHandle(index), *GetObject(index));
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> std::size_t HandlePool<TObject>::CalcBufferSize(std::size_t numObjects) noexcept
+    {
+        return BlockAllocator::CalcBufferSize(MemoryUtils::GetBlockSize<TObject>(), numObjects) + (sizeof(Slot) + sizeof(std::uint32_t)) * numObjects;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> void HandlePool<TObject>::InitSlots() noexcept
+    {
+        m_slots = reinterpret_cast<Slot*>(m_buffer + BlockAllocator::CalcBufferSize(MemoryUtils::GetBlockSize<TObject>(), m_numObjects));
+        m_denseList = reinterpret_cast<std::uint32_t*>(m_slots + m_numObjects);
+
+        for (std::size_t i = 0; i < m_numObjects; ++i)
+        {
+            new (m_slots + i) Slot();
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> TObject* HandlePool<TObject>::GetObject(std::uint32_t index) const noexcept
+    {
+        return reinterpret_cast<TObject*>(m_buffer + MemoryUtils::GetBlockSize<TObject>() * index);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> typename HandlePool<TObject>::Handle HandlePool<TObject>::MakeHandle(std::uint32_t index) const noexcept
+    {
+        Handle handle;
+        handle.m_value = (m_slots[index].m_generation << k_numIndexBits) | index;
+
+        return handle;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> std::uint32_t HandlePool<TObject>::GetLiveIndex(Handle handle) const noexcept
+    {
+        auto index = handle.m_value & k_indexMask;
+        if (index >= m_numObjects)
+        {
+            return k_indexMask;
+        }
+
+        const auto& slot = m_slots[index];
+        if (slot.m_generation != (handle.m_value >> k_numIndexBits) || slot.m_denseIndex >= m_numLiveObjects || m_denseList[slot.m_denseIndex] != index)
+        {
+            return k_indexMask;
+        }
+
+        return index;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> HandlePool<TObject>::~HandlePool() noexcept
+    {
+        while (m_numLiveObjects > 0)
+        {
+            Destroy(MakeHandle(m_denseList[m_numLiveObjects - 1]));
+        }
+
+        // The block allocator doesn't own the buffer, so it can be freed before the block
+        // allocator is destroyed.
+        if (m_parentAllocator)
+        {
+            m_parentAllocator->Deallocate(m_buffer);
+        }
+        else
+        {
+            MemoryUtils::DeallocateAligned(m_buffer);
+        }
+    }
+}
+
+#endif
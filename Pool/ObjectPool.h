@@ -26,10 +26,12 @@
 #define _ICMEMORY_POOL_OBJECTPOOL_H_
 
 #include "../Allocator/BlockAllocator.h"
+#include "../Allocator/ConcurrentBlockAllocator.h"
 #include "../Utility/MemoryUtils.h"
 #include "../Container/UniquePtr.h"
 
 #include <cstdint>
+#include <type_traits>
 
 namespace IC
 {
@@ -38,10 +40,12 @@ namespace IC
     ///
     /// The object pool can be backed by any of the allocators.
     ///
-    /// This is not thread-safe and should not be accessed from multiple threads at
-    /// the same time.
+    /// The objects are allocated using a BlockAllocator by default, in which case this
+    /// is not thread-safe and should not be accessed from multiple threads at the same
+    /// time. If ConcurrentBlockAllocator is used instead, objects can be created and
+    /// destroyed from multiple threads at the same time.
     ///
-    template <typename TObject> class ObjectPool final
+    template <typename TObject, typename TBlockAllocator> class ObjectPool final
     {
     public:
         /// Creates a new object pool containing the given number of objects. The
@@ -49,8 +53,12 @@ namespace IC
         ///
         /// @param numObjects
         ///        The number of objects which should be in the pool.
+        /// @param enableForEach
+        ///        Optional. Whether or not ForEach() can be used, which requires the block
+        ///        allocator to track allocated objects. This is only supported when using
+        ///        BlockAllocator. Defaults to false.
         ///
-        ObjectPool(std::size_t numObjects) noexcept;
+        ObjectPool(std::size_t numObjects, bool enableForEach = false) noexcept;
 
         /// Creates a new object pool containing the given number of objects. The 
         /// memory block used for the pool is allocated from the given allocator.
@@ -59,8 +67,12 @@ namespace IC
         ///        The allocator from which to allocate the memory block.
         /// @param numObjects
         ///        The number of objects in the pool.
+        /// @param enableForEach
+        ///        Optional. Whether or not ForEach() can be used, which requires the block
+        ///        allocator to track allocated objects. This is only supported when using
+        ///        BlockAllocator. Defaults to false.
         ///
-        ObjectPool(IAllocator& allocator, std::size_t numObjects) noexcept;
+        ObjectPool(IAllocator& allocator, std::size_t numObjects, bool enableForEach = false) noexcept;
         
         /// This is thread safe.
         ///
@@ -86,13 +98,70 @@ namespace IC
         ///
         template <typename... TConstructorArgs> UniquePtr<TObject> Create(TConstructorArgs&&... constructorArgs) noexcept;
 
+        /// Creates the given number of new objects from the pool, each constructed with
+        /// the same arguments. The memory for the objects is allocated in batches, so this
+        /// is cheaper than calling Create() for each. Objects taken from memory which has
+        /// never been used are contiguous and in address order. If there are not enough
+        /// free objects left in the pool then this will assert.
+        ///
+        /// @param numObjects
+        ///        The number of objects to create.
+        /// @param out_objects
+        ///        (Out) The array the newly constructed objects are written to. This must
+        ///        have space for at least numObjects objects.
+        /// @param constructorArgs
+        ///        The arguments for the constructor if appropriate. These are passed to
+        ///        every object, so are not forwarded.
+        ///
+        template <typename... TConstructorArgs> void CreateMany(std::size_t numObjects, UniquePtr<TObject>* out_objects, const TConstructorArgs&... constructorArgs) noexcept;
+
+        /// Calls the given function for each live object in the pool, in address order.
+        /// This walks the block allocator's allocated block bitmap, so it is only available
+        /// when the pool was created with ForEach() enabled. Objects must not be created or
+        /// destroyed while iterating.
+        ///
+        /// @param function
+        ///        The function to call, which takes a reference to the object.
+        ///
+        template <typename TFunction> void ForEach(TFunction&& function) noexcept;
+
     private:
+        static constexpr std::size_t k_batchSize = 64;
+
         ObjectPool(ObjectPool&) = delete;
         ObjectPool& operator=(ObjectPool&) = delete;
         ObjectPool(ObjectPool&&) = delete;
         ObjectPool& operator=(ObjectPool&&) = delete;
 
-        BlockAllocator m_blockAllocator;
+        /// Creates the block allocator from the free store, passing on whether or not
+        /// allocated blocks should be tracked. Only BlockAllocator supports this.
+        ///
+        ObjectPool(std::size_t numObjects, bool enableForEach, std::true_type) noexcept;
+
+        /// Creates the block allocator from the free store, for block allocators which
+        /// don't support tracking allocated blocks.
+        ///
+        ObjectPool(std::size_t numObjects, bool enableForEach, std::false_type) noexcept;
+
+        /// Creates the block allocator from the given allocator, passing on whether or not
+        /// allocated blocks should be tracked. Only BlockAllocator supports this.
+        ///
+        ObjectPool(IAllocator& allocator, std::size_t numObjects, bool enableForEach, std::true_type) noexcept;
+
+        /// Creates the block allocator from the given allocator, for block allocators which
+        /// don't support tracking allocated blocks.
+        ///
+        ObjectPool(IAllocator& allocator, std::size_t numObjects, bool enableForEach, std::false_type) noexcept;
+
+        /// @param object
+        ///        An object which has been constructed in memory allocated from the pool.
+        ///
+        /// @return A unique pointer which owns the object, and returns it to the pool when
+        /// destroyed.
+        ///
+        UniquePtr<TObject> CreateUniquePtr(TObject* object) noexcept;
+
+        TBlockAllocator m_blockAllocator;
     };
 }
 
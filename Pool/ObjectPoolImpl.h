@@ -29,29 +29,89 @@
 
 namespace IC
 {
+    template <typename TObject, typename TBlockAllocator> constexpr std::size_t ObjectPool<TObject, TBlockAllocator>::k_batchSize;
+
     //------------------------------------------------------------------------------
-    template <typename TObject> ObjectPool<TObject>::ObjectPool(std::size_t numObjects) noexcept
-        : m_blockAllocator(MemoryUtils::GetBlockSize<TObject>(), numObjects)
+    template <typename TObject, typename TBlockAllocator> ObjectPool<TObject, TBlockAllocator>::ObjectPool(std::size_t numObjects, bool enableForEach) noexcept
+        : ObjectPool(numObjects, enableForEach, std::is_same<TBlockAllocator, BlockAllocator>())
     {
     }
+
     //------------------------------------------------------------------------------
-    template <typename TObject> ObjectPool<TObject>::ObjectPool(IAllocator& allocator, std::size_t numObjects) noexcept
-        : m_blockAllocator(allocator, MemoryUtils::GetBlockSize<TObject>(), numObjects)
+    template <typename TObject, typename TBlockAllocator> ObjectPool<TObject, TBlockAllocator>::ObjectPool(IAllocator& allocator, std::size_t numObjects, bool enableForEach) noexcept
+        : ObjectPool(allocator, numObjects, enableForEach, std::is_same<TBlockAllocator, BlockAllocator>())
     {
     }
 
     //------------------------------------------------------------------------------
-    template <typename TObject> template <typename... TConstructorArgs> UniquePtr<TObject> ObjectPool<TObject>::Create(TConstructorArgs&&... constructorArgs) noexcept
+    template <typename TObject, typename TBlockAllocator> template <typename... TConstructorArgs> UniquePtr<TObject> ObjectPool<TObject, TBlockAllocator>::Create(TConstructorArgs&&... constructorArgs) noexcept
     {
-        void* memory = m_blockAllocator.Allocate(sizeof(TObject));
+        void* memory = m_blockAllocator.Allocate(sizeof(TObject), alignof(TObject));
         TObject* newObject = new (memory) TObject(std::forward<TConstructorArgs>(constructorArgs)...);
 
-        return UniquePtr<TObject>(newObject, [=](TObject* objectForDeallocation) noexcept -> void
+        return CreateUniquePtr(newObject);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject, typename TBlockAllocator> template <typename... TConstructorArgs> 
+    void ObjectPool<TObject, TBlockAllocator>::CreateMany(std::size_t numObjects, UniquePtr<TObject>* out_objects, const TConstructorArgs&... constructorArgs) noexcept
+    {
+        assert(out_objects || numObjects == 0);
+
+        void* memory[k_batchSize];
+        for (std::size_t batchStart = 0; batchStart < numObjects; batchStart += k_batchSize)
         {
-            objectForDeallocation->~TObject();
-            m_blockAllocator.Deallocate(reinterpret_cast<void*>(objectForDeallocation));
+            auto batchSize = std::min(k_batchSize, numObjects - batchStart);
+            m_blockAllocator.AllocateBatch(sizeof(TObject), batchSize, memory);
+
+            for (std::size_t i = 0; i < batchSize; ++i)
+            {
+                TObject* newObject = new (memory[i]) TObject(constructorArgs...);
+                out_objects[batchStart + i] = CreateUniquePtr(newObject);
+            }
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject, typename TBlockAllocator> template <typename TFunction> void ObjectPool<TObject, TBlockAllocator>::ForEach(TFunction&& function) noexcept
+    {
+        m_blockAllocator.ForEachAllocatedBlock([&function](void* block) noexcept -> void
+        {
+            function(*reinterpret_cast<TObject*>(block));
         });
     }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject, typename TBlockAllocator> ObjectPool<TObject, TBlockAllocator>::ObjectPool(std::size_t numObjects, bool enableForEach, std::true_type) noexcept
+        : m_blockAllocator(MemoryUtils::GetBlockSize<TObject>(), numObjects, enableForEach)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject, typename TBlockAllocator> ObjectPool<TObject, TBlockAllocator>::ObjectPool(std::size_t numObjects, bool enableForEach, std::false_type) noexcept
+        : m_blockAllocator(MemoryUtils::GetBlockSize<TObject>(), numObjects)
+    {
+        assert(!enableForEach);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject, typename TBlockAllocator> ObjectPool<TObject, TBlockAllocator>::ObjectPool(IAllocator& allocator, std::size_t numObjects, bool enableForEach, std::true_type) noexcept
+        : m_blockAllocator(allocator, MemoryUtils::GetBlockSize<TObject>(), numObjects, enableForEach)
+    {
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject, typename TBlockAllocator> ObjectPool<TObject, TBlockAllocator>::ObjectPool(IAllocator& allocator, std::size_t numObjects, bool enableForEach, std::false_type) noexcept
+        : m_blockAllocator(allocator, MemoryUtils::GetBlockSize<TObject>(), numObjects)
+    {
+        assert(!enableForEach);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject, typename TBlockAllocator> UniquePtr<TObject> ObjectPool<TObject, TBlockAllocator>::CreateUniquePtr(TObject* object) noexcept
+    {
+        return UniquePtr<TObject>(object, UniquePtrDeleter<TObject>(m_blockAllocator));
+    }
 }
 
 #endif
\ No newline at end of file
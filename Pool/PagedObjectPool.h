@@ -26,14 +26,17 @@
 #define _ICMEMORY_POOL_PAGEDOBJECTPOOL_H_
 
 #include "../Allocator/PagedBlockAllocator.h"
+#include "../Container/UniquePtr.h"
 
 namespace IC
 {
     /// An object pool which consists of a series of pages. Each page is a memory
     /// block which represents a contiquous list of objects. The pool initially
     /// contains a single page; an additional page is allocated every time there
-    /// are no free objects in any of the existing pages. Once a page has been
-    /// created it will not be deallocated until the PagedObjectPool is destroyed.
+    /// are no free objects in any of the existing pages. When a page becomes empty 
+    /// it is kept for reuse, unless the maximum number of empty pages has been 
+    /// reached, in which case it is released. Empty pages can also be released by
+    /// calling Trim().
     ///
     /// The object pool can be backed by any of the allocators.
     ///
@@ -46,13 +49,19 @@ namespace IC
         static constexpr std::size_t k_defaultNumObjectsPerPage = 128;
 
         /// Creates a new object pool containing the given number of objects in each
-        /// page. Memory used for the pool is allocated from the free store.
+        /// page. Memory used for the pool is reserved from the operating system.
         ///
         /// @param numObjectsPerPage
-        ///        Optional. The number of objects in each page. Defaults to 
+        ///        Optional. The minimum number of objects in each page. Defaults to 
         ///        k_defaultNumObjectsPerPage.
+        /// @param maxEmptyPages
+        ///        Optional. The maximum number of empty pages which are kept for reuse. 
+        ///        Defaults to PagedBlockAllocator::k_defaultMaxEmptyPages.
+        /// @param enableForEach
+        ///        Optional. Whether or not ForEach() can be used, which requires each page
+        ///        to track allocated objects. Defaults to false.
         ///
-        PagedObjectPool(std::size_t numObjectsPerPage = k_defaultNumObjectsPerPage) noexcept;
+        PagedObjectPool(std::size_t numObjectsPerPage = k_defaultNumObjectsPerPage, std::size_t maxEmptyPages = PagedBlockAllocator::k_defaultMaxEmptyPages, bool enableForEach = false) noexcept;
 
         /// Creates a new object pool containing the given number of objects in each
         /// page. Memory used for the pool is allocated from the given allocator.
@@ -60,14 +69,21 @@ namespace IC
         /// @param allocator
         ///        The allocator from which to allocate the memory block.
         /// @param numObjectsPerPage
-        ///        Optional. The number of objects in each page. Defaults to 
+        ///        Optional. The minimum number of objects in each page. Defaults to 
         ///        k_defaultNumObjectsPerPage.
+        /// @param maxEmptyPages
+        ///        Optional. The maximum number of empty pages which are kept for reuse. 
+        ///        Defaults to PagedBlockAllocator::k_defaultMaxEmptyPages.
+        /// @param enableForEach
+        ///        Optional. Whether or not ForEach() can be used, which requires each page
+        ///        to track allocated objects. Defaults to false.
         ///
-        PagedObjectPool(IAllocator& allocator, std::size_t numObjectsPerPage = k_defaultNumObjectsPerPage) noexcept;
+        PagedObjectPool(IAllocator& allocator, std::size_t numObjectsPerPage = k_defaultNumObjectsPerPage, std::size_t maxEmptyPages = PagedBlockAllocator::k_defaultMaxEmptyPages, bool enableForEach = false) noexcept;
 
         /// This is thread safe. 
         ///
-        /// @return The number of objects in each page.
+        /// @return The number of objects in each page. This may be greater than the
+        /// number requested.
         ///
         std::size_t GetNumObjectsPerPage() const noexcept { return m_pagedBlockAllocator.GetNumBlocksPerPage(); }
 
@@ -81,6 +97,24 @@ namespace IC
         ///
         template <typename... TConstructorArgs> UniquePtr<TObject> Create(TConstructorArgs&&... constructorArgs) noexcept;
 
+        /// @return The number of pages in the pool.
+        ///
+        std::size_t GetNumPages() const noexcept { return m_pagedBlockAllocator.GetNumPages(); }
+
+        /// Releases all pages which contain no objects.
+        ///
+        void Trim() noexcept;
+
+        /// Calls the given function for each live object in the pool. Objects are visited
+        /// page by page, and in address order within each page. This is only available when
+        /// the pool was created with ForEach() enabled. Objects must not be created or
+        /// destroyed while iterating.
+        ///
+        /// @param function
+        ///        The function to call, which takes a reference to the object.
+        ///
+        template <typename TFunction> void ForEach(TFunction&& function) noexcept;
+
     private:
         PagedObjectPool(PagedObjectPool&) = delete;
         PagedObjectPool& operator=(PagedObjectPool&) = delete;
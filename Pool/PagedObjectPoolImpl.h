@@ -30,27 +30,38 @@
 namespace IC
 {
     //------------------------------------------------------------------------------
-    template <typename TObject> PagedObjectPool<TObject>::PagedObjectPool(std::size_t numObjectsPerPage) noexcept
-        : m_pagedBlockAllocator(MemoryUtils::GetBlockSize<TObject>(), numObjectsPerPage)
+    template <typename TObject> PagedObjectPool<TObject>::PagedObjectPool(std::size_t numObjectsPerPage, std::size_t maxEmptyPages, bool enableForEach) noexcept
+        : m_pagedBlockAllocator(MemoryUtils::GetBlockSize<TObject>(), numObjectsPerPage, maxEmptyPages, enableForEach)
     {
     }
 
     //------------------------------------------------------------------------------
-    template <typename TObject> PagedObjectPool<TObject>::PagedObjectPool(IAllocator& allocator, std::size_t numObjectsPerPage) noexcept
-        : m_pagedBlockAllocator(allocator, MemoryUtils::GetBlockSize<TObject>(), numObjectsPerPage)
+    template <typename TObject> PagedObjectPool<TObject>::PagedObjectPool(IAllocator& allocator, std::size_t numObjectsPerPage, std::size_t maxEmptyPages, bool enableForEach) noexcept
+        : m_pagedBlockAllocator(allocator, MemoryUtils::GetBlockSize<TObject>(), numObjectsPerPage, maxEmptyPages, enableForEach)
     {
     }
 
     //------------------------------------------------------------------------------
     template <typename TObject> template <typename... TConstructorArgs> UniquePtr<TObject> PagedObjectPool<TObject>::Create(TConstructorArgs&&... constructorArgs) noexcept
     {
-        void* memory = m_pagedBlockAllocator.Allocate(sizeof(TObject));
+        void* memory = m_pagedBlockAllocator.Allocate(sizeof(TObject), alignof(TObject));
         TObject* newObject = new (memory) TObject(std::forward<TConstructorArgs>(constructorArgs)...);
 
-        return UniquePtr<TObject>(newObject, [=](TObject* objectForDeallocation) noexcept -> void
+        return UniquePtr<TObject>(newObject, UniquePtrDeleter<TObject>(m_pagedBlockAllocator));
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> void PagedObjectPool<TObject>::Trim() noexcept
+    {
+        m_pagedBlockAllocator.Trim();
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename TObject> template <typename TFunction> void PagedObjectPool<TObject>::ForEach(TFunction&& function) noexcept
+    {
+        m_pagedBlockAllocator.ForEachAllocatedBlock([&function](void* block) noexcept -> void
         {
-            objectForDeallocation->~TObject();
-            m_pagedBlockAllocator.Deallocate(reinterpret_cast<void*>(objectForDeallocation));
+            function(*reinterpret_cast<TObject*>(block));
         });
     }
 }
@@ -0,0 +1,198 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORY_POOL_SOAPOOL_H_
+#define _ICMEMORY_POOL_SOAPOOL_H_
+
+#include "../Allocator/IAllocator.h"
+#include "../Utility/IndexSequence.h"
+#include "../Utility/MemoryUtils.h"
+
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+namespace IC
+{
+    /// A fixed size pool which stores objects in structure-of-arrays layout. Rather than
+    /// storing whole objects, each field is stored in its own contiguous column, so loops
+    /// which only need some of the fields only touch the memory for those fields. Each 
+    /// column is aligned to k_columnAlignment, to suit vectorised loops.
+    ///
+    /// Live objects are always packed at the start of the columns. When an object is
+    /// destroyed, the last object is moved into its place. Objects are referred to by
+    /// an id which stays the same when the object is moved; the id can be looked up to
+    /// find the current index of the object in the columns in O(1). Ids of destroyed
+    /// objects are reused; use a HandlePool where stale references must be detected.
+    ///
+    /// The pool can be backed by any of the allocators.
+    ///
+    /// This is not thread-safe and should not be accessed from multiple threads at the
+    /// same time.
+    ///
+    template <typename... TFields> class SoAPool final
+    {
+    public:
+        static constexpr std::size_t k_columnAlignment = 64;
+        static constexpr std::uint32_t k_invalidId = 0xffffffff;
+
+        /// The type of the field with the given index.
+        ///
+        template <std::size_t TFieldIndex> using Field = typename std::tuple_element<TFieldIndex, std::tuple<TFields...>>::type;
+
+        /// Creates a new pool with space for the given number of objects. The columns are
+        /// allocated from the free store.
+        ///
+        /// @param capacity
+        ///        The maximum number of objects in the pool.
+        ///
+        SoAPool(std::size_t capacity) noexcept;
+
+        /// Creates a new pool with space for the given number of objects. The columns are
+        /// allocated from the given allocator.
+        ///
+        /// @param allocator
+        ///        The allocator from which to allocate the columns.
+        /// @param capacity
+        ///        The maximum number of objects in the pool.
+        ///
+        SoAPool(IAllocator& allocator, std::size_t capacity) noexcept;
+
+        /// This is thread safe.
+        ///
+        /// @return The maximum number of objects in the pool.
+        ///
+        std::size_t GetCapacity() const noexcept { return m_capacity; }
+
+        /// @return The number of live objects in the pool. These occupy the first entries
+        /// in each column.
+        ///
+        std::size_t GetSize() const noexcept { return m_size; }
+
+        /// Creates a new object at the end of the columns. If the pool is full this will
+        /// assert.
+        ///
+        /// @param fields
+        ///        The value of each field.
+        ///
+        /// @return The id of the new object.
+        ///
+        std::uint32_t Create(TFields... fields) noexcept;
+
+        /// Destroys the object with the given id. The last object in the columns is moved
+        /// into its place, so the columns stay packed. If the id does not refer to a live
+        /// object this will assert.
+        ///
+        /// @param id
+        ///        The id of the object.
+        ///
+        void Destroy(std::uint32_t id) noexcept;
+
+        /// @param id
+        ///        The id.
+        ///
+        /// @return Whether or not the id refers to a live object.
+        ///
+        bool IsValid(std::uint32_t id) const noexcept;
+
+        /// @param id
+        ///        The id of a live object.
+        ///
+        /// @return The current index of the object in the columns.
+        ///
+        std::size_t GetIndex(std::uint32_t id) const noexcept;
+
+        /// @param index
+        ///        The index of a live object in the columns.
+        ///
+        /// @return The id of the object at the given index.
+        ///
+        std::uint32_t GetId(std::size_t index) const noexcept;
+
+        /// @param id
+        ///        The id of a live object.
+        ///
+        /// @return The given field of the object.
+        ///
+        template <std::size_t TFieldIndex> Field<TFieldIndex>& Get(std::uint32_t id) noexcept;
+
+        /// @return The start of the column for the given field. The first GetSize() entries
+        /// are the fields of the live objects. This is invalidated by destroying an object.
+        ///
+        template <std::size_t TFieldIndex> Field<TFieldIndex>* GetColumn() noexcept;
+
+        /// @return The start of the column for the given field. The first GetSize() entries
+        /// are the fields of the live objects. This is invalidated by destroying an object.
+        ///
+        template <std::size_t TFieldIndex> const Field<TFieldIndex>* GetColumn() const noexcept;
+
+        ~SoAPool() noexcept;
+
+    private:
+        SoAPool(SoAPool&) = delete;
+        SoAPool& operator=(SoAPool&) = delete;
+        SoAPool(SoAPool&&) = delete;
+        SoAPool& operator=(SoAPool&&) = delete;
+
+        /// Allocates the columns and the id tables.
+        ///
+        template <std::size_t... TFieldIndices> void Init(IndexSequence<TFieldIndices...>) noexcept;
+
+        /// Constructs each field of the object at the given index.
+        ///
+        template <std::size_t... TFieldIndices> void ConstructFields(std::size_t index, IndexSequence<TFieldIndices...>, TFields&&... fields) noexcept;
+
+        /// Moves each field of the object at the source index into the destination index,
+        /// then destroys the fields at the source index. If the indices are the same, the
+        /// fields are just destroyed.
+        ///
+        template <std::size_t... TFieldIndices> void MoveFields(std::size_t destinationIndex, std::size_t sourceIndex, IndexSequence<TFieldIndices...>) noexcept;
+
+        /// Deallocates the columns and the id tables.
+        ///
+        template <std::size_t... TFieldIndices> void Release(IndexSequence<TFieldIndices...>) noexcept;
+
+        /// @param size
+        ///        The size of the buffer.
+        ///
+        /// @return A buffer of the given size, aligned to k_columnAlignment.
+        ///
+        void* AllocateBuffer(std::size_t size) noexcept;
+
+        /// @param buffer
+        ///        A buffer allocated with AllocateBuffer().
+        ///
+        void DeallocateBuffer(void* buffer) noexcept;
+
+        const std::size_t m_capacity;
+        IAllocator* m_parentAllocator = nullptr;
+
+        std::tuple<TFields*...> m_columns;
+        std::uint32_t* m_indices = nullptr;
+        std::uint32_t* m_ids = nullptr;
+        std::size_t m_size = 0;
+    };
+}
+
+#include "SoAPoolImpl.h"
+
+#endif
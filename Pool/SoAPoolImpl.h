@@ -0,0 +1,207 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef _ICMEMORY_POOL_SOAPOOLIMPL_H_
+#define _ICMEMORY_POOL_SOAPOOLIMPL_H_
+
+#include <algorithm>
+#include <new>
+
+namespace IC
+{
+    template <typename... TFields> constexpr std::size_t SoAPool<TFields...>::k_columnAlignment;
+    template <typename... TFields> constexpr std::uint32_t SoAPool<TFields...>::k_invalidId;
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> SoAPool<TFields...>::SoAPool(std::size_t capacity) noexcept
+        : m_capacity(capacity)
+    {
+        Init(IndexSequenceFor<TFields...>());
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> SoAPool<TFields...>::SoAPool(IAllocator& allocator, std::size_t capacity) noexcept
+        : m_capacity(capacity), m_parentAllocator(&allocator)
+    {
+        Init(IndexSequenceFor<TFields...>());
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> std::uint32_t SoAPool<TFields...>::Create(TFields... fields) noexcept
+    {
+        assert(m_size < m_capacity);
+
+        ConstructFields(m_size, IndexSequenceFor<TFields...>(), std::move(fields)...);
+
+        auto id = m_ids[m_size];
+        m_indices[id] = static_cast<std::uint32_t>(m_size);
+        ++m_size;
+
+        return id;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> void SoAPool<TFields...>::Destroy(std::uint32_t id) noexcept
+    {
+        assert(IsValid(id));
+
+        auto index = m_indices[id];
+        auto lastIndex = static_cast<std::uint32_t>(m_size - 1);
+        auto lastId = m_ids[lastIndex];
+
+        MoveFields(index, lastIndex, IndexSequenceFor<TFields...>());
+
+        // The destroyed id is swapped to just past the live ids, so it is reused by the
+        // next call to Create().
+        m_ids[index] = lastId;
+        m_indices[lastId] = index;
+        m_ids[lastIndex] = id;
+        m_indices[id] = lastIndex;
+
+        --m_size;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> bool SoAPool<TFields...>::IsValid(std::uint32_t id) const noexcept
+    {
+        return id < m_capacity && m_indices[id] < m_size;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> std::size_t SoAPool<TFields...>::GetIndex(std::uint32_t id) const noexcept
+    {
+        assert(IsValid(id));
+
+        return m_indices[id];
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> std::uint32_t SoAPool<TFields...>::GetId(std::size_t index) const noexcept
+    {
+        assert(index < m_size);
+
+        return m_ids[index];
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> template <std::size_t TFieldIndex> typename SoAPool<TFields...>::template Field<TFieldIndex>& SoAPool<TFields...>::Get(std::uint32_t id) noexcept
+    {
+        return GetColumn<TFieldIndex>()[GetIndex(id)];
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> template <std::size_t TFieldIndex> typename SoAPool<TFields...>::template Field<TFieldIndex>* SoAPool<TFields...>::GetColumn() noexcept
+    {
+        return std::get<TFieldIndex>(m_columns);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> template <std::size_t TFieldIndex> const typename SoAPool<TFields...>::template Field<TFieldIndex>* SoAPool<TFields...>::GetColumn() const noexcept
+    {
+        return std::get<TFieldIndex>(m_columns);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> template <std::size_t... TFieldIndices> void SoAPool<TFields...>::Init(IndexSequence<TFieldIndices...>) noexcept
+    {
+        assert(m_capacity < k_invalidId);
+
+        int expander[] = { 0, (std::get<TFieldIndices>(m_columns) = reinterpret_cast<Field<TFieldIndices>*>(AllocateBuffer(sizeof(Field<TFieldIndices>) * m_capacity)), 0)... };
+        (void)expander;
+
+        m_indices = reinterpret_cast<std::uint32_t*>(AllocateBuffer(sizeof(std::uint32_t) * m_capacity * 2));
+        m_ids = m_indices + m_capacity;
+
+        for (std::size_t i = 0; i < m_capacity; ++i)
+        {
+            m_indices[i] = static_cast<std::uint32_t>(i);
+            m_ids[i] = static_cast<std::uint32_t>(i);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> template <std::size_t... TFieldIndices> void SoAPool<TFields...>::ConstructFields(std::size_t index, IndexSequence<TFieldIndices...>, TFields&&... fields) noexcept
+    {
+        int expander[] = { 0, (new (std::get<TFieldIndices>(m_columns) + index) TFields(std::move(fields)), 0)... };
+        (void)expander;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> template <std::size_t... TFieldIndices> void SoAPool<TFields...>::MoveFields(std::size_t destinationIndex, std::size_t sourceIndex, IndexSequence<TFieldIndices...>) noexcept
+    {
+        if (destinationIndex != sourceIndex)
+        {
+            int expander[] = { 0, (std::get<TFieldIndices>(m_columns)[destinationIndex] = std::move(std::get<TFieldIndices>(m_columns)[sourceIndex]), 0)... };
+            (void)expander;
+        }
+
+        int expander[] = { 0, ((std::get<TFieldIndices>(m_columns) + sourceIndex)->~TFields(), 0)... };
+        (void)expander;
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> template <std::size_t... TFieldIndices> void SoAPool<TFields...>::Release(IndexSequence<TFieldIndices...>) noexcept
+    {
+        for (std::size_t i = 0; i < m_size; ++i)
+        {
+            int expander[] = { 0, ((std::get<TFieldIndices>(m_columns) + i)->~TFields(), 0)... };
+            (void)expander;
+        }
+
+        int expander[] = { 0, (DeallocateBuffer(std::get<TFieldIndices>(m_columns)), 0)... };
+        (void)expander;
+
+        DeallocateBuffer(m_indices);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> void* SoAPool<TFields...>::AllocateBuffer(std::size_t size) noexcept
+    {
+        if (m_parentAllocator)
+        {
+            return m_parentAllocator->Allocate(size, k_columnAlignment);
+        }
+
+        return MemoryUtils::AllocateAligned(size, k_columnAlignment);
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> void SoAPool<TFields...>::DeallocateBuffer(void* buffer) noexcept
+    {
+        if (m_parentAllocator)
+        {
+            m_parentAllocator->Deallocate(buffer);
+        }
+        else
+        {
+            MemoryUtils::DeallocateAligned(buffer);
+        }
+    }
+
+    //------------------------------------------------------------------------------
+    template <typename... TFields> SoAPool<TFields...>::~SoAPool() noexcept
+    {
+        Release(IndexSequenceFor<TFields...>());
+    }
+}
+
+#endif
@@ -0,0 +1,57 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef _ICMEMORY_UTILTY_INDEXSEQUENCE_H_
+#define _ICMEMORY_UTILTY_INDEXSEQUENCE_H_
+
+#include <cstddef>
+
+namespace IC
+{
+    /// A compile time sequence of indices, for expanding a parameter pack alongside its
+    /// position. This is equivalent to std::index_sequence, which requires C++14.
+    ///
+    template <std::size_t... TIndices> struct IndexSequence final
+    {
+    };
+
+    /// Builds an IndexSequence of 0 to TSize - 1. The sequence is available as the
+    /// nested Type.
+    ///
+    template <std::size_t TSize, std::size_t... TIndices> struct MakeIndexSequence final
+    {
+        using Type = typename MakeIndexSequence<TSize - 1, TSize - 1, TIndices...>::Type;
+    };
+
+    template <std::size_t... TIndices> struct MakeIndexSequence<0, TIndices...> final
+    {
+        using Type = IndexSequence<TIndices...>;
+    };
+
+    /// An IndexSequence with one index for each type in the given pack. This is equivalent
+    /// to std::index_sequence_for.
+    ///
+    template <typename... TTypes> using IndexSequenceFor = typename MakeIndexSequence<sizeof...(TTypes)>::Type;
+}
+
+#endif
@@ -89,6 +89,13 @@ namespace IC
         ///
         template <typename TType> std::size_t CalcShift(TType value) noexcept;
 
+        /// @param value
+        ///     The value. Must be non-zero.
+        ///
+        /// @return The number of trailing zero bits in the given value.
+        ///
+        inline std::size_t CalcTrailingZeros(std::uintptr_t value) noexcept;
+
         /// @param pointer
         ///     The pointer.
         /// @param relativeTo
@@ -99,6 +106,32 @@ namespace IC
         ///
         template <typename TTypeA, typename TTypeB> std::uintptr_t GetPointerOffset(TTypeA* pointer, TTypeB* relativeTo) noexcept;
 
+        /// @param value
+        ///     The value. Must be non-zero.
+        ///
+        /// @return The largest power of two which the given value is a multiple of. 
+        ///
+        template <typename TType> constexpr TType CalcNaturalAlignment(TType value) noexcept;
+
+        /// Allocates a buffer of the given size from the free store, aligned to the given
+        /// alignment. This must be deallocated with DeallocateAligned().
+        ///
+        /// @param size
+        ///     The size of the buffer.
+        /// @param alignment
+        ///     The alignment of the buffer. Must be a power of two.
+        ///
+        /// @return The aligned buffer.
+        ///
+        inline void* AllocateAligned(std::size_t size, std::size_t alignment) noexcept;
+
+        /// Deallocates a buffer which was allocated with AllocateAligned().
+        ///
+        /// @param pointer
+        ///     The aligned buffer.
+        ///
+        inline void DeallocateAligned(void* pointer) noexcept;
+
         /// Calculates the size of block required for the given object type
         ///
         /// @return The block size.
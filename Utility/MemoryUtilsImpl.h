@@ -26,6 +26,11 @@
 #define _ICMEMORY_UTILTY_MEMORYUTILSIMPL_H_
 
 #include <algorithm>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace IC
 {
@@ -107,6 +112,24 @@ namespace IC
             return output;
         }
 
+        //------------------------------------------------------------------------------
+        inline std::size_t CalcTrailingZeros(std::uintptr_t value) noexcept
+        {
+            assert(value != 0);
+
+#if defined(_MSC_VER) && defined(_WIN64)
+            unsigned long output;
+            _BitScanForward64(&output, value);
+            return output;
+#elif defined(_MSC_VER)
+            unsigned long output;
+            _BitScanForward(&output, value);
+            return output;
+#else
+            return sizeof(std::uintptr_t) == sizeof(unsigned long long) ? __builtin_ctzll(value) : __builtin_ctz(static_cast<unsigned int>(value));
+#endif
+        }
+
         //------------------------------------------------------------------------------
         template <typename TTypeA, typename TTypeB> std::uintptr_t GetPointerOffset(TTypeA* pointer, TTypeB* relativeTo) noexcept
         {
@@ -117,10 +140,41 @@ namespace IC
             return (pointerInt - relativeToInt);
         }
 
+        //------------------------------------------------------------------------------
+        template <typename TType> constexpr TType CalcNaturalAlignment(TType value) noexcept
+        {
+            static_assert(std::is_integral<TType>::value, "Value must be integral type.");
+            static_assert(std::is_unsigned<TType>::value, "Value must be unsigned.");
+
+            return value & (~value + 1);
+        }
+
+        //------------------------------------------------------------------------------
+        inline void* AllocateAligned(std::size_t size, std::size_t alignment) noexcept
+        {
+            assert(IsPowerOfTwo(alignment));
+
+            // The original allocation is stored immediately before the aligned buffer.
+            auto allocation = new std::uint8_t[size + alignment - 1 + sizeof(std::uint8_t*)];
+            auto alignedBuffer = Align(allocation + sizeof(std::uint8_t*), alignment);
+            std::memcpy(alignedBuffer - sizeof(std::uint8_t*), &allocation, sizeof(std::uint8_t*));
+
+            return alignedBuffer;
+        }
+
+        //------------------------------------------------------------------------------
+        inline void DeallocateAligned(void* pointer) noexcept
+        {
+            std::uint8_t* allocation;
+            std::memcpy(&allocation, reinterpret_cast<std::uint8_t*>(pointer) - sizeof(std::uint8_t*), sizeof(std::uint8_t*));
+
+            delete[] allocation;
+        }
+
         //------------------------------------------------------------------------------
         template <typename TObject> constexpr std::size_t GetBlockSize() noexcept
         {
-            return std::max(sizeof(std::intptr_t) * 2, MemoryUtils::Align(sizeof(TObject), sizeof(std::intptr_t)));
+            return MemoryUtils::Align(sizeof(TObject), sizeof(std::intptr_t));
         }
     }
 }
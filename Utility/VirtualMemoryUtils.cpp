@@ -0,0 +1,219 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "VirtualMemoryUtils.h"
+#include "MemoryUtils.h"
+
+#include <cassert>
+#include <cstdio>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace IC
+{
+    namespace VirtualMemoryUtils
+    {
+        //------------------------------------------------------------------------------
+        std::size_t GetPageSize() noexcept
+        {
+#if defined(_WIN32)
+            SYSTEM_INFO systemInfo;
+            GetSystemInfo(&systemInfo);
+            return static_cast<std::size_t>(systemInfo.dwPageSize);
+#else
+            return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        std::size_t GetHugePageSize() noexcept
+        {
+#if defined(_WIN32)
+            auto hugePageSize = static_cast<std::size_t>(GetLargePageMinimum());
+            return (hugePageSize > 0) ? hugePageSize : GetPageSize();
+#elif defined(__linux__)
+            static const std::size_t hugePageSize = []() noexcept
+            {
+                std::size_t sizeKiB = 0;
+                if (auto file = std::fopen("/proc/meminfo", "r"))
+                {
+                    char line[256];
+                    while (std::fgets(line, sizeof(line), file))
+                    {
+                        if (std::sscanf(line, "Hugepagesize: %zu kB", &sizeKiB) == 1)
+                        {
+                            break;
+                        }
+                    }
+
+                    std::fclose(file);
+                }
+
+                return (sizeKiB > 0) ? sizeKiB * 1024 : std::size_t(2 * 1024 * 1024);
+            }();
+
+            return hugePageSize;
+#else
+            return GetPageSize();
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        void* Reserve(std::size_t size) noexcept
+        {
+#if defined(_WIN32)
+            return VirtualAlloc(nullptr, size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+            auto flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#if defined(MAP_NORESERVE)
+            flags |= MAP_NORESERVE;
+#endif
+            auto pointer = mmap(nullptr, size, PROT_NONE, flags, -1, 0);
+            return (pointer != MAP_FAILED) ? pointer : nullptr;
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        void* ReserveAligned(std::size_t size, std::size_t alignment) noexcept
+        {
+            assert(MemoryUtils::IsPowerOfTwo(alignment));
+
+            auto pageSize = GetPageSize();
+            if (alignment <= pageSize)
+            {
+                return Reserve(size);
+            }
+
+            assert(MemoryUtils::IsAligned(alignment, pageSize));
+
+            auto reservedSize = size + alignment - pageSize;
+
+#if defined(_WIN32)
+            // Part of a reservation can't be released on Windows, so the aligned address is
+            // found from an oversized reservation, which is then released and reserved again
+            // at that address. Another thread can take the range in between, so retry.
+            constexpr int k_maxAttempts = 8;
+            for (int attempt = 0; attempt < k_maxAttempts; ++attempt)
+            {
+                auto reservedPointer = reinterpret_cast<std::uint8_t*>(Reserve(reservedSize));
+                if (!reservedPointer)
+                {
+                    return nullptr;
+                }
+
+                auto alignedPointer = MemoryUtils::Align(reservedPointer, alignment);
+                VirtualFree(reservedPointer, 0, MEM_RELEASE);
+
+                if (auto pointer = VirtualAlloc(alignedPointer, size, MEM_RESERVE, PAGE_NOACCESS))
+                {
+                    return pointer;
+                }
+            }
+
+            return nullptr;
+#else
+            auto reservedPointer = reinterpret_cast<std::uint8_t*>(Reserve(reservedSize));
+            if (!reservedPointer)
+            {
+                return nullptr;
+            }
+
+            auto alignedPointer = MemoryUtils::Align(reservedPointer, alignment);
+            auto headSize = static_cast<std::size_t>(alignedPointer - reservedPointer);
+            auto tailSize = reservedSize - headSize - size;
+
+            if (headSize > 0)
+            {
+                Release(reservedPointer, headSize);
+            }
+
+            if (tailSize > 0)
+            {
+                Release(alignedPointer + size, tailSize);
+            }
+
+            return alignedPointer;
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        bool Commit(void* pointer, std::size_t size) noexcept
+        {
+#if defined(_WIN32)
+            return VirtualAlloc(pointer, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+            return mprotect(pointer, size, PROT_READ | PROT_WRITE) == 0;
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        void Discard(void* pointer, std::size_t size) noexcept
+        {
+#if defined(_WIN32)
+            VirtualAlloc(pointer, size, MEM_RESET, PAGE_READWRITE);
+#else
+            madvise(pointer, size, MADV_DONTNEED);
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        void* ReserveHugePages(std::size_t size) noexcept
+        {
+#if defined(_WIN32)
+            return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+#elif defined(MAP_HUGETLB)
+            auto pointer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            return (pointer != MAP_FAILED) ? pointer : nullptr;
+#else
+            return nullptr;
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        void AdviseHugePages(void* pointer, std::size_t size) noexcept
+        {
+#if !defined(_WIN32) && defined(MADV_HUGEPAGE)
+            madvise(pointer, size, MADV_HUGEPAGE);
+#endif
+        }
+
+        //------------------------------------------------------------------------------
+        void Release(void* pointer, std::size_t size) noexcept
+        {
+#if defined(_WIN32)
+            auto result = VirtualFree(pointer, 0, MEM_RELEASE);
+#else
+            auto result = (munmap(pointer, size) == 0);
+#endif
+            assert(result);
+            (void)result;
+        }
+    }
+}
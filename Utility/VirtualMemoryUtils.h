@@ -0,0 +1,136 @@
+// The MIT License(MIT)
+// 
+// Copyright(c) 2026 ICMemory contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef _ICMEMORY_UTILTY_VIRTUALMEMORYUTILS_H_
+#define _ICMEMORY_UTILTY_VIRTUALMEMORYUTILS_H_
+
+#include "../ForwardDeclarations.h"
+
+#include <cstddef>
+
+namespace IC
+{
+    /// Thin wrappers around the platform's virtual memory functions: VirtualAlloc() and
+    /// VirtualFree() on Windows, and mmap(), mprotect() and madvise() elsewhere.
+    ///
+    namespace VirtualMemoryUtils
+    {
+        /// This is thread-safe.
+        ///
+        /// @return The size of a virtual memory page. All sizes and addresses passed to
+        /// the other functions must be multiples of this.
+        ///
+        std::size_t GetPageSize() noexcept;
+
+        /// This is thread-safe.
+        ///
+        /// @return The size of a huge page, or the normal page size if huge pages aren't
+        /// supported on this platform.
+        ///
+        std::size_t GetHugePageSize() noexcept;
+
+        /// Reserves a range of address space of the given size. The memory cannot be
+        /// accessed until it has been committed.
+        ///
+        /// @param size
+        ///     The size of the range. Must be a multiple of the page size.
+        ///
+        /// @return The start of the reserved range, or null if it couldn't be reserved.
+        ///
+        void* Reserve(std::size_t size) noexcept;
+
+        /// Reserves a range of address space of the given size, starting at an address
+        /// which is a multiple of the given alignment. The excess address space needed to
+        /// find an aligned range is released again, so the range can be released with
+        /// Release() like any other. The memory cannot be accessed until it has been
+        /// committed.
+        ///
+        /// @param size
+        ///     The size of the range. Must be a multiple of the page size.
+        /// @param alignment
+        ///     The alignment of the range. Must be a power of two and a multiple of the
+        ///     page size.
+        ///
+        /// @return The start of the reserved range, or null if it couldn't be reserved.
+        ///
+        void* ReserveAligned(std::size_t size, std::size_t alignment) noexcept;
+
+        /// Commits the given part of a reserved range, allowing it to be read and
+        /// written.
+        ///
+        /// @param pointer
+        ///     The start of the memory to commit. Must be page aligned.
+        /// @param size
+        ///     The size of the memory to commit. Must be a multiple of the page size.
+        ///
+        /// @return Whether or not the memory could be committed.
+        ///
+        bool Commit(void* pointer, std::size_t size) noexcept;
+
+        /// Tells the operating system that the contents of the given committed memory
+        /// are no longer needed, so the physical memory backing it can be reclaimed. The
+        /// memory remains committed and can still be accessed, but its contents are
+        /// undefined.
+        ///
+        /// @param pointer
+        ///     The start of the memory to discard. Must be page aligned.
+        /// @param size
+        ///     The size of the memory to discard. Must be a multiple of the page size.
+        ///
+        void Discard(void* pointer, std::size_t size) noexcept;
+
+        /// Reserves and commits a range backed by explicit huge pages, such as those
+        /// from the Linux hugetlbfs pool. This fails if there are not enough huge pages
+        /// available, or if they aren't supported on this platform.
+        ///
+        /// @param size
+        ///     The size of the range. Must be a multiple of the huge page size.
+        ///
+        /// @return The start of the committed range, or null if it couldn't be allocated.
+        ///
+        void* ReserveHugePages(std::size_t size) noexcept;
+
+        /// Hints to the operating system that the given memory should be backed by 
+        /// transparent huge pages. This does nothing on platforms which don't support
+        /// transparent huge pages.
+        ///
+        /// @param pointer
+        ///     The start of the memory. Must be page aligned.
+        /// @param size
+        ///     The size of the memory. Must be a multiple of the page size.
+        ///
+        void AdviseHugePages(void* pointer, std::size_t size) noexcept;
+
+        /// Releases a range which was reserved with Reserve(), including any committed
+        /// memory within it.
+        ///
+        /// @param pointer
+        ///     The start of the reserved range.
+        /// @param size
+        ///     The size of the reserved range.
+        ///
+        void Release(void* pointer, std::size_t size) noexcept;
+    }
+}
+
+#endif